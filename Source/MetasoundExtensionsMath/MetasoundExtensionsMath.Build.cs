@@ -0,0 +1,21 @@
+﻿using UnrealBuildTool;
+
+public class MetasoundExtensionsMath : ModuleRules
+{
+	public MetasoundExtensionsMath(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		// Kept free of MetaSound and UObject dependencies so the kernels can be linked into tools and programs on their own.
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"SignalProcessing",
+			}
+		);
+
+		// MetasoundExtensionsMath.ispc is only compiled when the target builds ISPC; otherwise the C++ kernels are the only path.
+		PrivateDefinitions.Add("METASOUND_EXTENSIONS_MATH_WITH_ISPC=" + (Target.bCompileISPC ? "1" : "0"));
+	}
+}
@@ -0,0 +1,199 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsDecimation.h"
+
+#include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace DecimationPrivate
+		{
+			constexpr int32 NumFloatsPerVector = 4;
+
+			constexpr float TwoPi = 6.28318530717958648f;
+			constexpr float InvTwoPi = 0.15915494309189534f;
+
+			/** An evaluated frame: the scaled phase and its sine and cosine. */
+			struct FAnchor
+			{
+				float Phase = 0.0f;
+				float Sin = 0.0f;
+				float Cos = 1.0f;
+			};
+
+			FORCEINLINE FAnchor EvaluateAnchor(const float InValue, const float InScale, const FSinCosKernel& InKernel)
+			{
+				FAnchor Anchor;
+				Anchor.Phase = InValue * InScale;
+				InKernel.SinCos(Anchor.Phase, Anchor.Sin, Anchor.Cos);
+
+				return Anchor;
+			}
+
+			/** Phase travelled between two anchors, wrapped to [-PI, PI] so a wrapping input does not read as a full turn. */
+			FORCEINLINE float GetPhaseDelta(const FAnchor& InStart, const FAnchor& InEnd)
+			{
+				const float Delta = InEnd.Phase - InStart.Phase;
+				return Delta - TwoPi * FMath::RoundToFloat(Delta * InvTwoPi);
+			}
+
+			/** Writes InLength frames of the curve from InStart towards InEnd, excluding InEnd itself. Slopes are per
+			 *  segment, i.e. the derivative with respect to a position running from 0 to 1 across it. */
+			template <bool bCubic>
+			void FillSegment(float* OutData, const int32 InLength, const float InStart, const float InEnd, const float InStartSlope, const float InEndSlope)
+			{
+				// Polynomial in the segment position t: C3 t^3 + C2 t^2 + C1 t + C0.
+				const float C0 = InStart;
+				const float C1 = bCubic ? InStartSlope : (InEnd - InStart);
+				const float C2 = bCubic ? (3.0f * (InEnd - InStart) - 2.0f * InStartSlope - InEndSlope) : 0.0f;
+				const float C3 = bCubic ? (2.0f * (InStart - InEnd) + InStartSlope + InEndSlope) : 0.0f;
+
+				const float InvLength = 1.0f / static_cast<float>(InLength);
+				const int32 NumVectorized = InLength - (InLength % NumFloatsPerVector);
+
+				const VectorRegister4Float Lanes = MakeVectorRegisterFloat(0.0f, 1.0f, 2.0f, 3.0f);
+				const VectorRegister4Float InvLengthVector = VectorSetFloat1(InvLength);
+				const VectorRegister4Float C0Vector = VectorSetFloat1(C0);
+				const VectorRegister4Float C1Vector = VectorSetFloat1(C1);
+				const VectorRegister4Float C2Vector = VectorSetFloat1(C2);
+				const VectorRegister4Float C3Vector = VectorSetFloat1(C3);
+
+				for (int32 i = 0; i < NumVectorized; i += NumFloatsPerVector)
+				{
+					// Positions come from the frame index rather than a running sum, so long segments do not drift.
+					const VectorRegister4Float T = VectorMultiply(VectorAdd(Lanes, VectorSetFloat1(static_cast<float>(i))), InvLengthVector);
+
+					VectorRegister4Float Value;
+					if constexpr (bCubic)
+					{
+						Value = VectorMultiplyAdd(VectorMultiplyAdd(VectorMultiplyAdd(C3Vector, T, C2Vector), T, C1Vector), T, C0Vector);
+						Value = VectorMin(VectorSetFloat1(1.0f), VectorMax(VectorSetFloat1(-1.0f), Value));
+					}
+					else
+					{
+						Value = VectorMultiplyAdd(C1Vector, T, C0Vector);
+					}
+
+					VectorStore(Value, &OutData[i]);
+				}
+
+				for (int32 i = NumVectorized; i < InLength; ++i)
+				{
+					const float T = static_cast<float>(i) * InvLength;
+
+					if constexpr (bCubic)
+					{
+						OutData[i] = FMath::Clamp(((C3 * T + C2) * T + C1) * T + C0, -1.0f, 1.0f);
+					}
+					else
+					{
+						OutData[i] = C1 * T + C0;
+					}
+				}
+			}
+
+			template <bool bSinCos, bool bCubic>
+			void ArraySinCosDecimated(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, const float InScale, const int32 InStride, const FSinCosKernel& InKernel)
+			{
+				const int32 Num = InValues.Num();
+				const float* InData = InValues.GetData();
+				float* OutSinData = OutSinValues.GetData();
+				float* OutCosData = bSinCos ? OutCosValues.GetData() : nullptr;
+
+				const int32 LastFrame = Num - 1;
+
+				FAnchor Start = EvaluateAnchor(InData[0], InScale, InKernel);
+				int32 StartFrame = 0;
+
+				while (StartFrame < LastFrame)
+				{
+					const int32 EndFrame = FMath::Min(StartFrame + InStride, LastFrame);
+					const int32 Length = EndFrame - StartFrame;
+
+					// Read the next anchor before writing the segment, so the input may alias either output.
+					const FAnchor End = EvaluateAnchor(InData[EndFrame], InScale, InKernel);
+					const float PhaseDelta = GetPhaseDelta(Start, End);
+
+					FillSegment<bCubic>(&OutSinData[StartFrame], Length, Start.Sin, End.Sin, Start.Cos * PhaseDelta, End.Cos * PhaseDelta);
+
+					if constexpr (bSinCos)
+					{
+						FillSegment<bCubic>(&OutCosData[StartFrame], Length, Start.Cos, End.Cos, -Start.Sin * PhaseDelta, -End.Sin * PhaseDelta);
+					}
+
+					Start = End;
+					StartFrame = EndFrame;
+				}
+
+				OutSinData[LastFrame] = Start.Sin;
+
+				if constexpr (bSinCos)
+				{
+					OutCosData[LastFrame] = Start.Cos;
+				}
+			}
+		}
+
+		const TCHAR* LexToString(EDecimationInterpolation InInterpolation)
+		{
+			switch (InInterpolation)
+			{
+				case EDecimationInterpolation::Linear:
+					return TEXT("Linear");
+				case EDecimationInterpolation::Cubic:
+					return TEXT("Cubic");
+				default:
+					return TEXT("Unknown");
+			}
+		}
+
+		void ArraySinDecimated(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale, int32 InStride, EDecimationInterpolation InInterpolation, ETrigPrecision InPrecision)
+		{
+			check(InValues.Num() == OutValues.Num());
+
+			const int32 Stride = FMath::Min(InStride, MaxDecimationStride);
+			if (Stride <= 1 || InValues.Num() <= 2)
+			{
+				GetSinKernel(InPrecision).ArraySin(InValues, OutValues, InScale);
+				return;
+			}
+
+			const FSinCosKernel& Kernel = GetSinCosKernel(InPrecision);
+			if (EDecimationInterpolation::Cubic == InInterpolation)
+			{
+				DecimationPrivate::ArraySinCosDecimated<false, true>(InValues, OutValues, {}, InScale, Stride, Kernel);
+			}
+			else
+			{
+				DecimationPrivate::ArraySinCosDecimated<false, false>(InValues, OutValues, {}, InScale, Stride, Kernel);
+			}
+		}
+
+		void ArraySinCosDecimated(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale, int32 InStride, EDecimationInterpolation InInterpolation, ETrigPrecision InPrecision)
+		{
+			check(InValues.Num() == OutSinValues.Num());
+			check(InValues.Num() == OutCosValues.Num());
+
+			const FSinCosKernel& Kernel = GetSinCosKernel(InPrecision);
+
+			const int32 Stride = FMath::Min(InStride, MaxDecimationStride);
+			if (Stride <= 1 || InValues.Num() <= 2)
+			{
+				Kernel.ArraySinCos(InValues, OutSinValues, OutCosValues, InScale);
+				return;
+			}
+
+			if (EDecimationInterpolation::Cubic == InInterpolation)
+			{
+				DecimationPrivate::ArraySinCosDecimated<true, true>(InValues, OutSinValues, OutCosValues, InScale, Stride, Kernel);
+			}
+			else
+			{
+				DecimationPrivate::ArraySinCosDecimated<true, false>(InValues, OutSinValues, OutCosValues, InScale, Stride, Kernel);
+			}
+		}
+	}
+}
@@ -0,0 +1,836 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsMath.h"
+
+#include "DSP/FloatArrayMath.h"
+#include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
+#include "MetasoundExtensionsMathKernels.h"
+#include "MetasoundExtensionsSineTable.h"
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace MathPrivate
+		{
+			constexpr int32 NumFloatsPerVector = 4;
+
+			/** Sine of every whole degree. Built from the first quadrant so the symmetric entries match exactly. */
+			struct FIntegerDegreeSineTable
+			{
+				float Values[360];
+
+				FIntegerDegreeSineTable()
+				{
+					for (int32 Degrees = 0; Degrees <= 90; ++Degrees)
+					{
+						const float Value = (90 == Degrees) ? 1.0f : static_cast<float>(FMath::Sin(UE_DOUBLE_PI * static_cast<double>(Degrees) / 180.0));
+
+						Values[Degrees] = Value;
+						Values[180 - Degrees] = Value;
+
+						// Negating the zero at 0 degrees would write -0 over entries 0 and 180.
+						if (Degrees > 0)
+						{
+							Values[180 + Degrees] = -Value;
+							Values[360 - Degrees] = -Value;
+						}
+					}
+				}
+			};
+
+			static const FIntegerDegreeSineTable IntegerDegreeSineTable;
+
+			FORCEINLINE VectorRegister4Float VectorClampUnit(const VectorRegister4Float& InValue)
+			{
+				return VectorMin(VectorSetFloat1(1.0f), VectorMax(VectorSetFloat1(-1.0f), InValue));
+			}
+
+			FORCEINLINE VectorRegister4Float SinVector(const VectorRegister4Float& InX)
+			{
+				const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+				const VectorRegister4Float One = VectorSetFloat1(1.0f);
+
+				const VectorRegister4Float Quadrant = VectorFloor(VectorMultiplyAdd(InX, VectorSetFloat1(TwoOverPi), Half));
+
+				VectorRegister4Float R = VectorMultiplyAdd(Quadrant, VectorSetFloat1(-PiOverTwoA), InX);
+				R = VectorMultiplyAdd(Quadrant, VectorSetFloat1(-PiOverTwoB), R);
+				R = VectorMultiplyAdd(Quadrant, VectorSetFloat1(-PiOverTwoC), R);
+
+				const VectorRegister4Float Z = VectorMultiply(R, R);
+
+				VectorRegister4Float Sin = VectorMultiplyAdd(Z, VectorSetFloat1(SinC7), VectorSetFloat1(SinC5));
+				Sin = VectorMultiplyAdd(Z, Sin, VectorSetFloat1(SinC3));
+				Sin = VectorMultiplyAdd(VectorMultiply(R, Z), Sin, R);
+
+				VectorRegister4Float Cos = VectorMultiplyAdd(Z, VectorSetFloat1(CosC8), VectorSetFloat1(CosC6));
+				Cos = VectorMultiplyAdd(Z, Cos, VectorSetFloat1(CosC4));
+				Cos = VectorMultiplyAdd(VectorMultiply(Z, Z), Cos, VectorMultiplyAdd(Z, VectorSetFloat1(-0.5f), One));
+
+				const VectorRegister4Float Q = VectorMultiplyAdd(VectorFloor(VectorMultiply(Quadrant, VectorSetFloat1(0.25f))), VectorSetFloat1(-4.0f), Quadrant);
+				const VectorRegister4Float Negate = VectorFloor(VectorMultiply(Q, Half));
+				const VectorRegister4Float UseCos = VectorMultiplyAdd(Negate, VectorSetFloat1(-2.0f), Q);
+
+				const VectorRegister4Float Value = VectorMultiplyAdd(UseCos, VectorSubtract(Cos, Sin), Sin);
+				return VectorClampUnit(VectorMultiply(Value, VectorMultiplyAdd(Negate, VectorSetFloat1(-2.0f), One)));
+			}
+
+			template <bool bFast>
+			FORCEINLINE void SinCosVector(const VectorRegister4Float& InX, VectorRegister4Float& OutSin, VectorRegister4Float& OutCos)
+			{
+				const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+				const VectorRegister4Float Quarter = VectorSetFloat1(0.25f);
+				const VectorRegister4Float One = VectorSetFloat1(1.0f);
+				const VectorRegister4Float MinusTwo = VectorSetFloat1(-2.0f);
+				const VectorRegister4Float MinusFour = VectorSetFloat1(-4.0f);
+
+				const VectorRegister4Float Quadrant = VectorFloor(VectorMultiplyAdd(InX, VectorSetFloat1(TwoOverPi), Half));
+
+				VectorRegister4Float R = VectorMultiplyAdd(Quadrant, VectorSetFloat1(-PiOverTwoA), InX);
+				R = VectorMultiplyAdd(Quadrant, VectorSetFloat1(-PiOverTwoB), R);
+				R = VectorMultiplyAdd(Quadrant, VectorSetFloat1(-PiOverTwoC), R);
+
+				const VectorRegister4Float Z = VectorMultiply(R, R);
+				VectorRegister4Float Sin;
+				VectorRegister4Float Cos;
+				if constexpr (bFast)
+				{
+					Sin = VectorMultiplyAdd(Z, VectorSetFloat1(FastSinCosS5), VectorSetFloat1(FastSinCosS3));
+					Sin = VectorMultiplyAdd(VectorMultiply(R, Z), Sin, R);
+
+					Cos = VectorMultiplyAdd(Z, VectorSetFloat1(FastSinCosC4), VectorSetFloat1(FastSinCosC2));
+					Cos = VectorMultiplyAdd(Z, Cos, One);
+				}
+				else
+				{
+					Sin = VectorMultiplyAdd(Z, VectorSetFloat1(SinC7), VectorSetFloat1(SinC5));
+					Sin = VectorMultiplyAdd(Z, Sin, VectorSetFloat1(SinC3));
+					Sin = VectorMultiplyAdd(VectorMultiply(R, Z), Sin, R);
+
+					Cos = VectorMultiplyAdd(Z, VectorSetFloat1(CosC8), VectorSetFloat1(CosC6));
+					Cos = VectorMultiplyAdd(Z, Cos, VectorSetFloat1(CosC4));
+					Cos = VectorMultiplyAdd(VectorMultiply(Z, Z), Cos, VectorMultiplyAdd(Z, VectorSetFloat1(-0.5f), One));
+				}
+
+				const VectorRegister4Float Q = VectorMultiplyAdd(VectorFloor(VectorMultiply(Quadrant, Quarter)), MinusFour, Quadrant);
+				const VectorRegister4Float NegateSin = VectorFloor(VectorMultiply(Q, Half));
+				const VectorRegister4Float Swap = VectorMultiplyAdd(NegateSin, MinusTwo, Q);
+				const VectorRegister4Float QPlusOne = VectorAdd(Q, One);
+				const VectorRegister4Float NextQ = VectorMultiplyAdd(VectorFloor(VectorMultiply(QPlusOne, Quarter)), MinusFour, QPlusOne);
+				const VectorRegister4Float NegateCos = VectorFloor(VectorMultiply(NextQ, Half));
+
+				const VectorRegister4Float Difference = VectorSubtract(Cos, Sin);
+				OutSin = VectorClampUnit(VectorMultiply(VectorMultiplyAdd(Swap, Difference, Sin), VectorMultiplyAdd(NegateSin, MinusTwo, One)));
+				OutCos = VectorClampUnit(VectorMultiply(VectorMultiplyAdd(VectorNegate(Swap), Difference, Cos), VectorMultiplyAdd(NegateCos, MinusTwo, One)));
+			}
+
+			template <bool bFast>
+			void ArraySinCosBaseline(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale)
+			{
+				check(InValues.Num() == OutSinValues.Num());
+				check(InValues.Num() == OutCosValues.Num());
+
+				const int32 Num = InValues.Num();
+				const int32 NumVectorized = Num - (Num % NumFloatsPerVector);
+				const float* InData = InValues.GetData();
+				float* OutSinData = OutSinValues.GetData();
+				float* OutCosData = OutCosValues.GetData();
+
+				const VectorRegister4Float Scale = VectorSetFloat1(InScale);
+				for (int32 i = 0; i < NumVectorized; i += NumFloatsPerVector)
+				{
+					VectorRegister4Float Sin;
+					VectorRegister4Float Cos;
+					SinCosVector<bFast>(VectorMultiply(VectorLoad(&InData[i]), Scale), Sin, Cos);
+
+					VectorStore(Sin, &OutSinData[i]);
+					VectorStore(Cos, &OutCosData[i]);
+				}
+
+				for (int32 i = NumVectorized; i < Num; ++i)
+				{
+					SinCosScalar<bFast>(InData[i] * InScale, OutSinData[i], OutCosData[i]);
+				}
+			}
+
+			void SinCosFast(float InX, float& OutSin, float& OutCos)
+			{
+				SinCosScalar<true>(InX, OutSin, OutCos);
+			}
+
+			void SinCosBalanced(float InX, float& OutSin, float& OutCos)
+			{
+				SinCosScalar<false>(InX, OutSin, OutCos);
+			}
+
+			// Three part split of pi/2 for the shared Exact reduction. The first two parts have 33 significant bits, so their
+			// products with any quadrant below 2^20 are exact.
+			constexpr double DoublePiOverTwoA = 1.5707963267341256;
+			constexpr double DoublePiOverTwoB = 6.077100506303966e-11;
+			constexpr double DoublePiOverTwoC = 2.0222662487959506e-21;
+			constexpr double DoubleTwoOverPi = 0.63661977236758134;
+			constexpr double SharedReductionLimit = 1.0e6;
+
+			/** libm has no shared sincos entry point on every platform, so Exact reduces to [-pi/4, pi/4] once in double
+			 *  precision and only hands libm the reduced argument, where neither call reduces again. The reduction is exact
+			 *  to 1e-26 below SharedReductionLimit; larger and non-finite inputs pay for libm's own two reductions. */
+			void SinCosDoubleExact(double InX, double& OutSin, double& OutCos)
+			{
+				if (!(FMath::Abs(InX) <= SharedReductionLimit))
+				{
+					OutSin = FMath::Sin(InX);
+					OutCos = FMath::Cos(InX);
+					return;
+				}
+
+				const double Quadrant = FMath::RoundToDouble(InX * DoubleTwoOverPi);
+
+				// Quadrant 0 skips the subtractions, which would turn -0 into +0.
+				const double R = (0.0 == Quadrant) ? InX : ((InX - Quadrant * DoublePiOverTwoA) - Quadrant * DoublePiOverTwoB) - Quadrant * DoublePiOverTwoC;
+				const double Sin = FMath::Sin(R);
+				const double Cos = FMath::Cos(R);
+
+				switch (static_cast<int64>(Quadrant) & 3)
+				{
+					case 0:
+						OutSin = Sin;
+						OutCos = Cos;
+						break;
+
+					case 1:
+						OutSin = Cos;
+						OutCos = -Sin;
+						break;
+
+					case 2:
+						OutSin = -Sin;
+						OutCos = -Cos;
+						break;
+
+					default:
+						OutSin = -Cos;
+						OutCos = Sin;
+						break;
+				}
+			}
+
+			/** Rounded from the double precision result, which stays within 1 ulp of the float sine and cosine. */
+			void SinCosExact(float InX, float& OutSin, float& OutCos)
+			{
+				double Sin = 0.0;
+				double Cos = 0.0;
+				SinCosDoubleExact(InX, Sin, Cos);
+
+				OutSin = static_cast<float>(Sin);
+				OutCos = static_cast<float>(Cos);
+			}
+
+			void ArraySinCosExact(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale)
+			{
+				check(InValues.Num() == OutSinValues.Num());
+				check(InValues.Num() == OutCosValues.Num());
+
+				const int32 Num = InValues.Num();
+				const float* InData = InValues.GetData();
+				float* OutSinData = OutSinValues.GetData();
+				float* OutCosData = OutCosValues.GetData();
+
+				for (int32 i = 0; i < Num; ++i)
+				{
+					SinCosExact(InData[i] * InScale, OutSinData[i], OutCosData[i]);
+				}
+			}
+
+			template <void (*SinCosFunction)(float, float&, float&)>
+			void SinCosDoubleThroughFloat(double InX, double& OutSin, double& OutCos)
+			{
+				float Sin = 0.0f;
+				float Cos = 0.0f;
+				SinCosFunction(static_cast<float>(InX), Sin, Cos);
+
+				OutSin = Sin;
+				OutCos = Cos;
+			}
+
+			FORCEINLINE VectorRegister4Float FastSinVector(const VectorRegister4Float& InX)
+			{
+				const VectorRegister4Float Turns = VectorFloor(VectorMultiplyAdd(InX, VectorSetFloat1(InvTwoPi), VectorSetFloat1(0.5f)));
+				VectorRegister4Float R = VectorMultiplyAdd(Turns, VectorSetFloat1(-TwoPiA), InX);
+				R = VectorMultiplyAdd(Turns, VectorSetFloat1(-TwoPiB), R);
+
+				const VectorRegister4Float Clamped = VectorMin(VectorMax(R, VectorSetFloat1(-HalfPi)), VectorSetFloat1(HalfPi));
+				const VectorRegister4Float U = VectorMultiplyAdd(Clamped, VectorSetFloat1(2.0f), VectorNegate(R));
+
+				const VectorRegister4Float Z = VectorMultiply(U, U);
+				VectorRegister4Float Poly = VectorMultiplyAdd(Z, VectorSetFloat1(FastSinC5), VectorSetFloat1(FastSinC3));
+				Poly = VectorMultiplyAdd(Z, Poly, VectorSetFloat1(FastSinC1));
+				return VectorClampUnit(VectorMultiply(U, Poly));
+			}
+
+			float SinFast(float InX)
+			{
+				return FastSinScalar(InX);
+			}
+
+			float SinBalanced(float InX)
+			{
+				return SinScalar(InX);
+			}
+
+			float SinExact(float InX)
+			{
+				return FMath::Sin(InX);
+			}
+
+			double SinDoubleFast(double InX)
+			{
+				return FastSinScalar(static_cast<float>(InX));
+			}
+
+			double SinDoubleBalanced(double InX)
+			{
+				return SinScalar(static_cast<float>(InX));
+			}
+
+			double SinDoubleExact(double InX)
+			{
+				return FMath::Sin(InX);
+			}
+
+			double SinDoubleTableLinear(double InX)
+			{
+				return SinTableLinear(static_cast<float>(InX));
+			}
+
+			double SinDoubleTableCubic(double InX)
+			{
+				return SinTableCubic(static_cast<float>(InX));
+			}
+
+			void ArraySinFastBaseline(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+			{
+				check(InValues.Num() == OutValues.Num());
+
+				const int32 Num = InValues.Num();
+				const int32 NumVectorized = Num - (Num % NumFloatsPerVector);
+				const float* InData = InValues.GetData();
+				float* OutData = OutValues.GetData();
+
+				const VectorRegister4Float Scale = VectorSetFloat1(InScale);
+				for (int32 i = 0; i < NumVectorized; i += NumFloatsPerVector)
+				{
+					const VectorRegister4Float X = VectorMultiply(VectorLoad(&InData[i]), Scale);
+					VectorStore(FastSinVector(X), &OutData[i]);
+				}
+
+				for (int32 i = NumVectorized; i < Num; ++i)
+				{
+					OutData[i] = FastSinScalar(InData[i] * InScale);
+				}
+			}
+
+			void ArraySinExact(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+			{
+				check(InValues.Num() == OutValues.Num());
+
+				const int32 Num = InValues.Num();
+				const float* InData = InValues.GetData();
+				float* OutData = OutValues.GetData();
+
+				for (int32 i = 0; i < Num; ++i)
+				{
+					OutData[i] = FMath::Sin(InData[i] * InScale);
+				}
+			}
+
+			FORCEINLINE VectorRegister4Float UnwindVector(const VectorRegister4Float& InX, const VectorRegister4Float& InInvPeriod, const VectorRegister4Float& InNegPeriodA, const VectorRegister4Float& InNegPeriodB)
+			{
+				const VectorRegister4Float Turns = VectorFloor(VectorMultiplyAdd(InX, InInvPeriod, VectorSetFloat1(0.5f)));
+				return VectorMultiplyAdd(Turns, InNegPeriodB, VectorMultiplyAdd(Turns, InNegPeriodA, InX));
+			}
+
+			void ArrayUnwindBaseline(TArrayView<const float> InValues, TArrayView<float> OutValues, const float InInvPeriod, const float InPeriodA, const float InPeriodB)
+			{
+				check(InValues.Num() == OutValues.Num());
+
+				const int32 Num = InValues.Num();
+				const int32 NumVectorized = Num - (Num % NumFloatsPerVector);
+				const float* InData = InValues.GetData();
+				float* OutData = OutValues.GetData();
+
+				const VectorRegister4Float InvPeriod = VectorSetFloat1(InInvPeriod);
+				const VectorRegister4Float NegPeriodA = VectorSetFloat1(-InPeriodA);
+				const VectorRegister4Float NegPeriodB = VectorSetFloat1(-InPeriodB);
+				for (int32 i = 0; i < NumVectorized; i += NumFloatsPerVector)
+				{
+					VectorStore(UnwindVector(VectorLoad(&InData[i]), InvPeriod, NegPeriodA, NegPeriodB), &OutData[i]);
+				}
+
+				for (int32 i = NumVectorized; i < Num; ++i)
+				{
+					OutData[i] = UnwindScalar(InData[i], InInvPeriod, InPeriodA, InPeriodB);
+				}
+			}
+			void ArraySinBalancedBaseline(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+			{
+				check(InValues.Num() == OutValues.Num());
+
+				const int32 Num = InValues.Num();
+				const int32 NumVectorized = Num - (Num % NumFloatsPerVector);
+				const float* InData = InValues.GetData();
+				float* OutData = OutValues.GetData();
+
+				const VectorRegister4Float Scale = VectorSetFloat1(InScale);
+				for (int32 i = 0; i < NumVectorized; i += NumFloatsPerVector)
+				{
+					const VectorRegister4Float X = VectorMultiply(VectorLoad(&InData[i]), Scale);
+					VectorStore(SinVector(X), &OutData[i]);
+				}
+
+				for (int32 i = NumVectorized; i < Num; ++i)
+				{
+					OutData[i] = SinScalar(InData[i] * InScale);
+				}
+			}
+
+			void ArrayScaleBaseline(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+			{
+				check(InValues.Num() == OutValues.Num());
+
+				if (InValues.GetData() == OutValues.GetData())
+				{
+					Audio::ArrayMultiplyByConstantInPlace(OutValues, InScale);
+				}
+				else
+				{
+					Audio::ArrayMultiplyByConstant(InValues, InScale, OutValues);
+				}
+			}
+
+			const FBlockKernels BaselineBlockKernels{
+				&ArraySinFastBaseline,
+				&ArraySinBalancedBaseline,
+				&ArraySinCosBaseline<true>,
+				&ArraySinCosBaseline<false>,
+				&ArrayUnwindBaseline,
+				&ArrayScaleBaseline};
+
+			/** Entry points for the kernel tables below, which are built once and so cannot hold the active tier's functions. */
+			void ArraySinFast(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+			{
+				GetBlockKernels().ArraySinFast(InValues, OutValues, InScale);
+			}
+
+			void ArraySinCosFast(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale)
+			{
+				GetBlockKernels().ArraySinCosFast(InValues, OutSinValues, OutCosValues, InScale);
+			}
+
+			void ArraySinCosBalanced(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale)
+			{
+				GetBlockKernels().ArraySinCosBalanced(InValues, OutSinValues, OutCosValues, InScale);
+			}
+		}
+
+		const TCHAR* LexToString(ETrigPrecision InPrecision)
+		{
+			switch (InPrecision)
+			{
+				case ETrigPrecision::Fast:
+					return TEXT("Fast");
+				case ETrigPrecision::Balanced:
+					return TEXT("Balanced");
+				case ETrigPrecision::Exact:
+					return TEXT("Exact");
+				case ETrigPrecision::TableLinear:
+					return TEXT("TableLinear");
+				case ETrigPrecision::TableCubic:
+					return TEXT("TableCubic");
+				default:
+					return TEXT("Unknown");
+			}
+		}
+
+		const FSinKernel& GetSinKernel(ETrigPrecision InPrecision)
+		{
+			using namespace MathPrivate;
+
+			static const FSinKernel FastKernel{&SinFast, &SinDoubleFast, &ArraySinFast};
+			static const FSinKernel BalancedKernel{&SinBalanced, &SinDoubleBalanced, &ArraySin};
+			static const FSinKernel ExactKernel{&SinExact, &SinDoubleExact, &ArraySinExact};
+			static const FSinKernel TableLinearKernel{&SinTableLinear, &SinDoubleTableLinear, &ArraySinTableLinear};
+			static const FSinKernel TableCubicKernel{&SinTableCubic, &SinDoubleTableCubic, &ArraySinTableCubic};
+
+			switch (InPrecision)
+			{
+				case ETrigPrecision::TableLinear:
+				case ETrigPrecision::TableCubic:
+				{
+					// The table is built in StartupModule; fall back to the polynomial if anything evaluates before that.
+					if (!ensureMsgf(IsSineTableInitialized(), TEXT("Shared sine table requested before it was initialized")))
+					{
+						return BalancedKernel;
+					}
+
+					return (ETrigPrecision::TableLinear == InPrecision) ? TableLinearKernel : TableCubicKernel;
+				}
+
+				case ETrigPrecision::Fast:
+					return FastKernel;
+
+				case ETrigPrecision::Balanced:
+					return BalancedKernel;
+
+				case ETrigPrecision::Exact:
+				default:
+					return ExactKernel;
+			}
+		}
+
+		float SinIntegerDegrees(int32 InDegrees)
+		{
+			int32 Index = InDegrees % 360;
+			if (Index < 0)
+			{
+				Index += 360;
+			}
+
+			return MathPrivate::IntegerDegreeSineTable.Values[Index];
+		}
+
+		const FSinCosKernel& GetSinCosKernel(ETrigPrecision InPrecision)
+		{
+			using namespace MathPrivate;
+
+			static const FSinCosKernel FastKernel{&SinCosFast, &SinCosDoubleThroughFloat<&SinCosFast>, &ArraySinCosFast};
+			static const FSinCosKernel BalancedKernel{&SinCosBalanced, &SinCosDoubleThroughFloat<&SinCosBalanced>, &ArraySinCosBalanced};
+			static const FSinCosKernel ExactKernel{&SinCosExact, &SinCosDoubleExact, &ArraySinCosExact};
+			static const FSinCosKernel TableLinearKernel{&SinCosTableLinear, &SinCosDoubleThroughFloat<&SinCosTableLinear>, &ArraySinCosTableLinear};
+			static const FSinCosKernel TableCubicKernel{&SinCosTableCubic, &SinCosDoubleThroughFloat<&SinCosTableCubic>, &ArraySinCosTableCubic};
+
+			switch (InPrecision)
+			{
+				case ETrigPrecision::TableLinear:
+				case ETrigPrecision::TableCubic:
+				{
+					if (!ensureMsgf(IsSineTableInitialized(), TEXT("Shared sine table requested before it was initialized")))
+					{
+						return BalancedKernel;
+					}
+
+					return (ETrigPrecision::TableLinear == InPrecision) ? TableLinearKernel : TableCubicKernel;
+				}
+
+				case ETrigPrecision::Fast:
+					return FastKernel;
+
+				case ETrigPrecision::Balanced:
+					return BalancedKernel;
+
+				case ETrigPrecision::Exact:
+				default:
+					return ExactKernel;
+			}
+		}
+
+		void SinCosIntegerDegrees(int32 InDegrees, float& OutSin, float& OutCos)
+		{
+			int32 Index = InDegrees % 360;
+			if (Index < 0)
+			{
+				Index += 360;
+			}
+
+			OutSin = MathPrivate::IntegerDegreeSineTable.Values[Index];
+			OutCos = MathPrivate::IntegerDegreeSineTable.Values[(Index + 90) % 360];
+		}
+
+		void ArraySin(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+		{
+			MathPrivate::GetBlockKernels().ArraySinBalanced(InValues, OutValues, InScale);
+		}
+
+		void ArrayScale(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+		{
+			MathPrivate::GetBlockKernels().ArrayScale(InValues, OutValues, InScale);
+		}
+
+		void ArrayUnwindDegrees(TArrayView<const float> InValues, TArrayView<float> OutValues)
+		{
+			MathPrivate::GetBlockKernels().ArrayUnwind(InValues, OutValues, 1.0f / 360.0f, 360.0f, 0.0f);
+		}
+
+		void ArrayUnwindRadians(TArrayView<const float> InValues, TArrayView<float> OutValues)
+		{
+			using namespace MathPrivate;
+
+			GetBlockKernels().ArrayUnwind(InValues, OutValues, InvTwoPi, TwoPiA, TwoPiB);
+		}
+
+		void ArraySinDegrees(TArrayView<const float> InValues, TArrayView<float> OutValues, const FSinKernel& InKernel)
+		{
+			using namespace MathPrivate;
+
+			check(InValues.Num() == OutValues.Num());
+
+			const int32 Num = InValues.Num();
+			const int32 NumVectorized = Num - (Num % NumFloatsPerVector);
+			const float* InData = InValues.GetData();
+			float* OutData = OutValues.GetData();
+
+			// Below 2^24, Turns * 360 is exact and lies within a factor of two of the input, so the remainder is exact.
+			const VectorRegister4Float MaxExactDegrees = VectorSetFloat1(16777216.0f);
+			const VectorRegister4Float InvPeriod = VectorSetFloat1(1.0f / 360.0f);
+			const VectorRegister4Float NegPeriod = VectorSetFloat1(-360.0f);
+			const VectorRegister4Float NegQuarter = VectorSetFloat1(-90.0f);
+			const VectorRegister4Float Quarter = VectorSetFloat1(90.0f);
+			const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+			for (int32 i = 0; i < NumVectorized; i += NumFloatsPerVector)
+			{
+				const VectorRegister4Float X = VectorLoad(&InData[i]);
+				if (VectorAnyGreaterThan(VectorAbs(X), MaxExactDegrees))
+				{
+					for (int32 j = i; j < i + NumFloatsPerVector; ++j)
+					{
+						OutData[j] = static_cast<float>(FoldSineDegrees(InData[j]));
+					}
+
+					continue;
+				}
+
+				const VectorRegister4Float Wrapped = UnwindVector(X, InvPeriod, NegPeriod, VectorZeroFloat());
+				const VectorRegister4Float Folded = VectorMultiplyAdd(Two, VectorMin(Quarter, VectorMax(NegQuarter, Wrapped)), VectorNegate(Wrapped));
+				VectorStore(Folded, &OutData[i]);
+			}
+
+			for (int32 i = NumVectorized; i < Num; ++i)
+			{
+				OutData[i] = static_cast<float>(FoldSineDegrees(InData[i]));
+			}
+
+			InKernel.ArraySin(OutValues, OutValues, UE_PI / 180.0f);
+		}
+
+		void ArraySinCosDegrees(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, const FSinCosKernel& InKernel)
+		{
+			using namespace MathPrivate;
+
+			check(InValues.Num() == OutSinValues.Num());
+			check(InValues.Num() == OutCosValues.Num());
+
+			// The quadrants have to outlive the kernel call that overwrites both outputs, so the block goes through in chunks.
+			constexpr int32 ChunkSize = 256;
+			float Reduced[ChunkSize];
+			float Quadrants[ChunkSize];
+
+			const float* InData = InValues.GetData();
+			float* OutSinData = OutSinValues.GetData();
+			float* OutCosData = OutCosValues.GetData();
+
+			// Below 2^24 both the unwind and the subtraction of the nearest quarter turn are exact, see ArraySinDegrees.
+			const VectorRegister4Float MaxExactDegrees = VectorSetFloat1(16777216.0f);
+			const VectorRegister4Float InvPeriod = VectorSetFloat1(1.0f / 360.0f);
+			const VectorRegister4Float NegPeriod = VectorSetFloat1(-360.0f);
+			const VectorRegister4Float InvQuarter = VectorSetFloat1(1.0f / 90.0f);
+			const VectorRegister4Float NegQuarter = VectorSetFloat1(-90.0f);
+			const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+			const VectorRegister4Float One = VectorSetFloat1(1.0f);
+			const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+			const VectorRegister4Float Three = VectorSetFloat1(3.0f);
+			const VectorRegister4Float Four = VectorSetFloat1(4.0f);
+			const VectorRegister4Float Zero = VectorZeroFloat();
+
+			for (int32 Start = 0; Start < InValues.Num(); Start += ChunkSize)
+			{
+				const int32 Num = FMath::Min(ChunkSize, InValues.Num() - Start);
+				const int32 NumVectorized = Num - (Num % NumFloatsPerVector);
+				const float* ChunkIn = &InData[Start];
+				float* ChunkSin = &OutSinData[Start];
+				float* ChunkCos = &OutCosData[Start];
+
+				for (int32 i = 0; i < NumVectorized; i += NumFloatsPerVector)
+				{
+					const VectorRegister4Float X = VectorLoad(&ChunkIn[i]);
+					if (VectorAnyGreaterThan(VectorAbs(X), MaxExactDegrees))
+					{
+						for (int32 j = i; j < i + NumFloatsPerVector; ++j)
+						{
+							int32 Quadrant = 0;
+							Reduced[j] = static_cast<float>(ReduceQuarterTurnDegrees(ChunkIn[j], Quadrant));
+							Quadrants[j] = static_cast<float>(Quadrant);
+						}
+
+						continue;
+					}
+
+					// Quarters runs from -2 to 2 over the unwound range; the quadrants count from 0 to 3.
+					const VectorRegister4Float Wrapped = UnwindVector(X, InvPeriod, NegPeriod, Zero);
+					const VectorRegister4Float Quarters = VectorFloor(VectorMultiplyAdd(Wrapped, InvQuarter, Half));
+					VectorStore(VectorMultiplyAdd(Quarters, NegQuarter, Wrapped), &Reduced[i]);
+					VectorStore(VectorSelect(VectorCompareLT(Quarters, Zero), VectorAdd(Quarters, Four), Quarters), &Quadrants[i]);
+				}
+
+				for (int32 i = NumVectorized; i < Num; ++i)
+				{
+					int32 Quadrant = 0;
+					Reduced[i] = static_cast<float>(ReduceQuarterTurnDegrees(ChunkIn[i], Quadrant));
+					Quadrants[i] = static_cast<float>(Quadrant);
+				}
+
+				// The input is fully read into Reduced, so the kernel may write over it when it aliases an output.
+				InKernel.ArraySinCos(MakeArrayView(Reduced, Num), MakeArrayView(ChunkSin, Num), MakeArrayView(ChunkCos, Num), UE_PI / 180.0f);
+
+				// Odd quadrants swap sine and cosine. Negation subtracts from zero so zero crossings stay +0, as in SinCosDegrees.
+				for (int32 i = 0; i < NumVectorized; i += NumFloatsPerVector)
+				{
+					const VectorRegister4Float Quadrant = VectorLoad(&Quadrants[i]);
+					const VectorRegister4Float Sin = VectorLoad(&ChunkSin[i]);
+					const VectorRegister4Float Cos = VectorLoad(&ChunkCos[i]);
+
+					const VectorRegister4Float Swap = VectorBitwiseOr(VectorCompareEQ(Quadrant, One), VectorCompareEQ(Quadrant, Three));
+					const VectorRegister4Float SwappedSin = VectorSelect(Swap, Cos, Sin);
+					const VectorRegister4Float SwappedCos = VectorSelect(Swap, Sin, Cos);
+
+					const VectorRegister4Float NegateSin = VectorCompareGE(Quadrant, Two);
+					const VectorRegister4Float NegateCos = VectorBitwiseOr(VectorCompareEQ(Quadrant, One), VectorCompareEQ(Quadrant, Two));
+
+					VectorStore(VectorSelect(NegateSin, VectorSubtract(Zero, SwappedSin), SwappedSin), &ChunkSin[i]);
+					VectorStore(VectorSelect(NegateCos, VectorSubtract(Zero, SwappedCos), SwappedCos), &ChunkCos[i]);
+				}
+
+				for (int32 i = NumVectorized; i < Num; ++i)
+				{
+					const float Quadrant = Quadrants[i];
+					const bool bSwap = (1.0f == Quadrant) || (3.0f == Quadrant);
+					const float Sin = bSwap ? ChunkCos[i] : ChunkSin[i];
+					const float Cos = bSwap ? ChunkSin[i] : ChunkCos[i];
+
+					ChunkSin[i] = (Quadrant >= 2.0f) ? (0.0f - Sin) : Sin;
+					ChunkCos[i] = (1.0f == Quadrant || 2.0f == Quadrant) ? (0.0f - Cos) : Cos;
+				}
+			}
+		}
+
+		void FRotationOscillator::SetPhase(double InRadians)
+		{
+			Phase = FMath::Fmod(InRadians, UE_DOUBLE_TWO_PI);
+			if (Phase < 0.0)
+			{
+				Phase += UE_DOUBLE_TWO_PI;
+			}
+
+			Resync();
+		}
+
+		void FRotationOscillator::SetStep(double InRadiansPerSample)
+		{
+			Step = InRadiansPerSample;
+
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				const double Angle = Step * static_cast<double>(Index + 1);
+				StepCos[Index] = static_cast<float>(FMath::Cos(Angle));
+				StepSin[Index] = static_cast<float>(FMath::Sin(Angle));
+			}
+		}
+
+		void FRotationOscillator::Generate(TArrayView<float> OutValues)
+		{
+			using namespace MathPrivate;
+
+			const int32 Num = OutValues.Num();
+			const int32 NumVectorized = Num - (Num % NumFloatsPerVector);
+			float* OutData = OutValues.GetData();
+
+			if (NumVectorized > 0)
+			{
+				// Lane k starts k samples ahead of the phasor, after which a four sample rotation keeps every lane in step.
+				const VectorRegister4Float LaneCos = MakeVectorRegisterFloat(1.0f, StepCos[0], StepCos[1], StepCos[2]);
+				const VectorRegister4Float LaneSin = MakeVectorRegisterFloat(0.0f, StepSin[0], StepSin[1], StepSin[2]);
+				const VectorRegister4Float StartCos = VectorSetFloat1(PhasorCos);
+				const VectorRegister4Float StartSin = VectorSetFloat1(PhasorSin);
+
+				VectorRegister4Float Cos = VectorNegateMultiplyAdd(StartSin, LaneSin, VectorMultiply(StartCos, LaneCos));
+				VectorRegister4Float Sin = VectorMultiplyAdd(StartSin, LaneCos, VectorMultiply(StartCos, LaneSin));
+
+				const VectorRegister4Float BlockStepCos = VectorSetFloat1(StepCos[3]);
+				const VectorRegister4Float BlockStepSin = VectorSetFloat1(StepSin[3]);
+				for (int32 i = 0; i < NumVectorized; i += NumFloatsPerVector)
+				{
+					VectorStore(Sin, &OutData[i]);
+
+					const VectorRegister4Float NextCos = VectorNegateMultiplyAdd(Sin, BlockStepSin, VectorMultiply(Cos, BlockStepCos));
+					Sin = VectorMultiplyAdd(Sin, BlockStepCos, VectorMultiply(Cos, BlockStepSin));
+					Cos = NextCos;
+				}
+
+				PhasorCos = VectorGetComponent(Cos, 0);
+				PhasorSin = VectorGetComponent(Sin, 0);
+			}
+
+			for (int32 i = NumVectorized; i < Num; ++i)
+			{
+				OutData[i] = PhasorSin;
+
+				const float NextCos = PhasorCos * StepCos[0] - PhasorSin * StepSin[0];
+				PhasorSin = PhasorSin * StepCos[0] + PhasorCos * StepSin[0];
+				PhasorCos = NextCos;
+			}
+
+			Phase = FMath::Fmod(Phase + Step * static_cast<double>(Num), UE_DOUBLE_TWO_PI);
+			if (Phase < 0.0)
+			{
+				Phase += UE_DOUBLE_TWO_PI;
+			}
+		}
+
+		void FRotationOscillator::Resync()
+		{
+			PhasorCos = static_cast<float>(FMath::Cos(Phase));
+			PhasorSin = static_cast<float>(FMath::Sin(Phase));
+		}
+
+		namespace MathPrivate
+		{
+			/** Wraps a phase in turns to [0, 1). Non-finite phases restart at 0, so one bad input cannot stick. */
+			FORCEINLINE double WrapTurns(double InTurns)
+			{
+				if (!FMath::IsFinite(InTurns))
+				{
+					return 0.0;
+				}
+
+				const double Wrapped = InTurns - FMath::FloorToDouble(InTurns);
+
+				// A tiny negative phase rounds up to exactly one turn.
+				return (Wrapped < 1.0) ? Wrapped : 0.0;
+			}
+		}
+
+		void FTimePhase::Reset(double InSeconds, double InFrequency)
+		{
+			Seconds = InSeconds;
+			Frequency = InFrequency;
+			Elapsed = 0.0;
+			Turns = MathPrivate::WrapTurns(InFrequency * InSeconds);
+		}
+
+		bool FTimePhase::Advance(double InSeconds, double InFrequency)
+		{
+			// Nearby times subtract exactly, so the step carries no error from the magnitude of the time itself.
+			Elapsed = InSeconds - Seconds;
+			const bool bMoved = (Elapsed != 0.0) && (Frequency != 0.0);
+
+			if (bMoved)
+			{
+				Turns = MathPrivate::WrapTurns(Turns + Frequency * Elapsed);
+			}
+
+			Seconds = InSeconds;
+			Frequency = InFrequency;
+
+			return bMoved;
+		}
+	}
+}
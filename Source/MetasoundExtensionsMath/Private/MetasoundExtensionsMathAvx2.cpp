@@ -0,0 +1,62 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsMathKernels.h"
+
+#if METASOUND_EXTENSIONS_MATH_WITH_AVX
+
+#include <immintrin.h>
+
+// Everything below may use AVX2 and FMA. It only runs after SetVectorTier has checked that the CPU and OS support both.
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx,avx2,fma"))), apply_to = function)
+#endif
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace MathPrivate
+		{
+			/** Eight floats per register, with fused multiply-adds. */
+			struct FAvx2Ops
+			{
+				using FRegister = __m256;
+
+				static constexpr int32 NumFloats = 8;
+
+				static FORCEINLINE FRegister Load(const float* InData) { return _mm256_loadu_ps(InData); }
+				static FORCEINLINE void Store(const FRegister InValue, float* OutData) { _mm256_storeu_ps(OutData, InValue); }
+				static FORCEINLINE FRegister Set(const float InValue) { return _mm256_set1_ps(InValue); }
+				static FORCEINLINE FRegister Add(const FRegister A, const FRegister B) { return _mm256_add_ps(A, B); }
+				static FORCEINLINE FRegister Subtract(const FRegister A, const FRegister B) { return _mm256_sub_ps(A, B); }
+				static FORCEINLINE FRegister Multiply(const FRegister A, const FRegister B) { return _mm256_mul_ps(A, B); }
+				static FORCEINLINE FRegister MultiplyAdd(const FRegister A, const FRegister B, const FRegister C) { return _mm256_fmadd_ps(A, B, C); }
+				static FORCEINLINE FRegister Negate(const FRegister InValue) { return _mm256_sub_ps(_mm256_setzero_ps(), InValue); }
+				static FORCEINLINE FRegister Floor(const FRegister InValue) { return _mm256_floor_ps(InValue); }
+
+				// Like VectorMin and VectorMax, these return the second operand when either is NaN.
+				static FORCEINLINE FRegister Min(const FRegister A, const FRegister B) { return _mm256_min_ps(A, B); }
+				static FORCEINLINE FRegister Max(const FRegister A, const FRegister B) { return _mm256_max_ps(A, B); }
+			};
+		}
+	}
+}
+
+#include "MetasoundExtensionsMathWide.inl"
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace MathPrivate
+		{
+			const FBlockKernels Avx2BlockKernels = WideKernels::MakeBlockKernels<FAvx2Ops>();
+		}
+	}
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
+
+#endif // METASOUND_EXTENSIONS_MATH_WITH_AVX
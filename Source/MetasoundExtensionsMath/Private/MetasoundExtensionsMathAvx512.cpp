@@ -0,0 +1,62 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsMathKernels.h"
+
+#if METASOUND_EXTENSIONS_MATH_WITH_AVX
+
+#include <immintrin.h>
+
+// Everything below may use AVX-512F. It only runs after SetVectorTier has checked that the CPU and OS support it.
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx,avx2,fma,avx512f"))), apply_to = function)
+#endif
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace MathPrivate
+		{
+			/** Sixteen floats per register, with fused multiply-adds. */
+			struct FAvx512Ops
+			{
+				using FRegister = __m512;
+
+				static constexpr int32 NumFloats = 16;
+
+				static FORCEINLINE FRegister Load(const float* InData) { return _mm512_loadu_ps(InData); }
+				static FORCEINLINE void Store(const FRegister InValue, float* OutData) { _mm512_storeu_ps(OutData, InValue); }
+				static FORCEINLINE FRegister Set(const float InValue) { return _mm512_set1_ps(InValue); }
+				static FORCEINLINE FRegister Add(const FRegister A, const FRegister B) { return _mm512_add_ps(A, B); }
+				static FORCEINLINE FRegister Subtract(const FRegister A, const FRegister B) { return _mm512_sub_ps(A, B); }
+				static FORCEINLINE FRegister Multiply(const FRegister A, const FRegister B) { return _mm512_mul_ps(A, B); }
+				static FORCEINLINE FRegister MultiplyAdd(const FRegister A, const FRegister B, const FRegister C) { return _mm512_fmadd_ps(A, B, C); }
+				static FORCEINLINE FRegister Negate(const FRegister InValue) { return _mm512_sub_ps(_mm512_setzero_ps(), InValue); }
+				static FORCEINLINE FRegister Floor(const FRegister InValue) { return _mm512_roundscale_ps(InValue, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+
+				// Like VectorMin and VectorMax, these return the second operand when either is NaN.
+				static FORCEINLINE FRegister Min(const FRegister A, const FRegister B) { return _mm512_min_ps(A, B); }
+				static FORCEINLINE FRegister Max(const FRegister A, const FRegister B) { return _mm512_max_ps(A, B); }
+			};
+		}
+	}
+}
+
+#include "MetasoundExtensionsMathWide.inl"
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace MathPrivate
+		{
+			const FBlockKernels Avx512BlockKernels = WideKernels::MakeBlockKernels<FAvx512Ops>();
+		}
+	}
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
+
+#endif // METASOUND_EXTENSIONS_MATH_WITH_AVX
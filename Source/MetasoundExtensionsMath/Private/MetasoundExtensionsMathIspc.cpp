@@ -0,0 +1,63 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsMathKernels.h"
+
+#if METASOUND_EXTENSIONS_MATH_WITH_ISPC
+
+#include "MetasoundExtensionsMath.ispc.generated.h"
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace MathPrivate
+		{
+			void ArraySinFastIspc(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+			{
+				check(InValues.Num() == OutValues.Num());
+
+				ispc::MetasoundExtensionsArraySinFast(InValues.GetData(), OutValues.GetData(), InValues.Num(), InScale);
+			}
+
+			void ArraySinBalancedIspc(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+			{
+				check(InValues.Num() == OutValues.Num());
+
+				ispc::MetasoundExtensionsArraySinBalanced(InValues.GetData(), OutValues.GetData(), InValues.Num(), InScale);
+			}
+
+			template <bool bFast>
+			void ArraySinCosIspc(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale)
+			{
+				check(InValues.Num() == OutSinValues.Num());
+				check(InValues.Num() == OutCosValues.Num());
+
+				ispc::MetasoundExtensionsArraySinCos(InValues.GetData(), OutSinValues.GetData(), OutCosValues.GetData(), InValues.Num(), InScale, bFast);
+			}
+
+			void ArrayUnwindIspc(TArrayView<const float> InValues, TArrayView<float> OutValues, const float InInvPeriod, const float InPeriodA, const float InPeriodB)
+			{
+				check(InValues.Num() == OutValues.Num());
+
+				ispc::MetasoundExtensionsArrayUnwind(InValues.GetData(), OutValues.GetData(), InValues.Num(), InInvPeriod, InPeriodA, InPeriodB);
+			}
+
+			void ArrayScaleIspc(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+			{
+				check(InValues.Num() == OutValues.Num());
+
+				ispc::MetasoundExtensionsArrayScale(InValues.GetData(), OutValues.GetData(), InValues.Num(), InScale);
+			}
+
+			const FBlockKernels IspcBlockKernels{
+				&ArraySinFastIspc,
+				&ArraySinBalancedIspc,
+				&ArraySinCosIspc<true>,
+				&ArraySinCosIspc<false>,
+				&ArrayUnwindIspc,
+				&ArrayScaleIspc};
+		}
+	}
+}
+
+#endif // METASOUND_EXTENSIONS_MATH_WITH_ISPC
@@ -0,0 +1,178 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "Math/UnrealMathUtility.h"
+
+#include <atomic>
+
+// The wide kernels need intrinsics the compiler will emit for a single function without enabling them for the whole
+// module, which MSVC and clang both allow. Other targets only ship the baseline tier.
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_DESKTOP && (defined(_MSC_VER) || defined(__clang__))
+#define METASOUND_EXTENSIONS_MATH_WITH_AVX 1
+#else
+#define METASOUND_EXTENSIONS_MATH_WITH_AVX 0
+#endif
+
+// Set by the module rules when the target compiles ISPC.
+#ifndef METASOUND_EXTENSIONS_MATH_WITH_ISPC
+#define METASOUND_EXTENSIONS_MATH_WITH_ISPC 0
+#endif
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace MathPrivate
+		{
+			// Cody-Waite split of pi/2 and the single precision minimax polynomials for sin and cos on [-pi/4, pi/4].
+			constexpr float TwoOverPi = 0.63661977236758134f;
+			constexpr float PiOverTwoA = 1.5703125f;
+			constexpr float PiOverTwoB = 4.837512969970703125e-4f;
+			constexpr float PiOverTwoC = 7.54978995489188216e-8f;
+
+			constexpr float SinC3 = -1.6666654611e-1f;
+			constexpr float SinC5 = 8.3321608736e-3f;
+			constexpr float SinC7 = -1.9515295891e-4f;
+
+			constexpr float CosC4 = 4.166664568298827e-2f;
+			constexpr float CosC6 = -1.388731625493765e-3f;
+			constexpr float CosC8 = 2.443315711809948e-5f;
+
+			// Degree 5 minimax polynomial for sin on [-pi/2, pi/2], used by the Fast precision mode.
+			constexpr float HalfPi = 1.5707963267948966f;
+			constexpr float FastSinC1 = 9.996967912e-1f;
+			constexpr float FastSinC3 = -1.656730771e-1f;
+			constexpr float FastSinC5 = 7.514377125e-3f;
+
+			// Degree 5 sin and degree 4 cos minimax polynomials on [-pi/4, pi/4], used by the Fast SinCos kernel.
+			constexpr float FastSinCosS3 = -1.6662833807e-1f;
+			constexpr float FastSinCosS5 = 8.1529923413e-3f;
+			constexpr float FastSinCosC2 = -4.9977630707e-1f;
+			constexpr float FastSinCosC4 = 4.0488935840e-2f;
+
+			// Two part split of 2*pi; the high part has few enough mantissa bits that Turns * TwoPiA stays exact.
+			constexpr float TwoPiA = 6.28125f;
+			constexpr float TwoPiB = 1.9353071795864769e-3f;
+			constexpr float InvTwoPi = 0.15915494309189534f;
+
+			/** Clamps to [-1, 1]. Past the exact range of the reduction the polynomials are evaluated outside the interval they
+			 *  were fitted on, and would otherwise return values far outside the unit range. The operand order lets NaN through. */
+			FORCEINLINE float ClampUnit(const float InValue)
+			{
+				return FMath::Min(1.0f, FMath::Max(-1.0f, InValue));
+			}
+
+			/** Scalar twin of SinVector, used for the tail of a block so every sample goes through the same approximation. */
+			FORCEINLINE float SinScalar(const float InX)
+			{
+				const float Quadrant = FMath::FloorToFloat(InX * TwoOverPi + 0.5f);
+
+				float R = InX - Quadrant * PiOverTwoA;
+				R = R - Quadrant * PiOverTwoB;
+				R = R - Quadrant * PiOverTwoC;
+
+				const float Z = R * R;
+				const float Sin = R + R * Z * (SinC3 + Z * (SinC5 + Z * SinC7));
+				const float Cos = 1.0f - 0.5f * Z + Z * Z * (CosC4 + Z * (CosC6 + Z * CosC8));
+
+				// Quadrant mod 4 selects between +-sin and +-cos without branching.
+				const float Q = Quadrant - 4.0f * FMath::FloorToFloat(Quadrant * 0.25f);
+				const float Negate = FMath::FloorToFloat(Q * 0.5f);
+				const float UseCos = Q - 2.0f * Negate;
+
+				return ClampUnit((Sin + UseCos * (Cos - Sin)) * (1.0f - 2.0f * Negate));
+			}
+
+			/** Shares one quadrant reduction between sine and cosine. bFast swaps in the lower order polynomials. */
+			template <bool bFast>
+			FORCEINLINE void SinCosScalar(const float InX, float& OutSin, float& OutCos)
+			{
+				const float Quadrant = FMath::FloorToFloat(InX * TwoOverPi + 0.5f);
+
+				float R = InX - Quadrant * PiOverTwoA;
+				R = R - Quadrant * PiOverTwoB;
+				R = R - Quadrant * PiOverTwoC;
+
+				const float Z = R * R;
+				float Sin = 0.0f;
+				float Cos = 0.0f;
+				if constexpr (bFast)
+				{
+					Sin = R + R * Z * (FastSinCosS3 + Z * FastSinCosS5);
+					Cos = 1.0f + Z * (FastSinCosC2 + Z * FastSinCosC4);
+				}
+				else
+				{
+					Sin = R + R * Z * (SinC3 + Z * (SinC5 + Z * SinC7));
+					Cos = 1.0f - 0.5f * Z + Z * Z * (CosC4 + Z * (CosC6 + Z * CosC8));
+				}
+
+				// Sine cycles through s, c, -s, -c over the quadrants and cosine through c, -s, -c, s.
+				const float Q = Quadrant - 4.0f * FMath::FloorToFloat(Quadrant * 0.25f);
+				const float NegateSin = FMath::FloorToFloat(Q * 0.5f);
+				const float Swap = Q - 2.0f * NegateSin;
+				const float NextQ = (Q + 1.0f) - 4.0f * FMath::FloorToFloat((Q + 1.0f) * 0.25f);
+				const float NegateCos = FMath::FloorToFloat(NextQ * 0.5f);
+
+				OutSin = ClampUnit((Sin + Swap * (Cos - Sin)) * (1.0f - 2.0f * NegateSin));
+				OutCos = ClampUnit((Cos + Swap * (Sin - Cos)) * (1.0f - 2.0f * NegateCos));
+			}
+
+			/** Reduces to [-pi, pi), mirrors into [-pi/2, pi/2] with 2 * clamp(x) - x and evaluates a single odd polynomial.
+			 *  The polynomial peaks at 1 + 6.8e-5, so here the clamp also matters inside the reduction's exact range. */
+			FORCEINLINE float FastSinScalar(const float InX)
+			{
+				const float Turns = FMath::FloorToFloat(InX * InvTwoPi + 0.5f);
+				const float R = (InX - Turns * TwoPiA) - Turns * TwoPiB;
+				const float U = 2.0f * FMath::Clamp(R, -HalfPi, HalfPi) - R;
+
+				const float Z = U * U;
+				return ClampUnit(U * (FastSinC1 + Z * (FastSinC3 + Z * FastSinC5)));
+			}
+
+			/** Removes the nearest whole number of periods, leaving the value in [-Period / 2, Period / 2). */
+			FORCEINLINE float UnwindScalar(const float InX, const float InInvPeriod, const float InPeriodA, const float InPeriodB)
+			{
+				const float Turns = FMath::FloorToFloat(InX * InInvPeriod + 0.5f);
+				return (InX - Turns * InPeriodA) - Turns * InPeriodB;
+			}
+
+			/** FBlockKernels
+			 *
+			 *  Block kernels built for one instruction set tier. Every tier evaluates the same polynomials with the
+			 *  same reduction, and finishes a block that is not a multiple of its width with the scalar functions above.
+			 */
+			struct FBlockKernels
+			{
+				void (*ArraySinFast)(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale);
+				void (*ArraySinBalanced)(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale);
+				void (*ArraySinCosFast)(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale);
+				void (*ArraySinCosBalanced)(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale);
+				void (*ArrayUnwind)(TArrayView<const float> InValues, TArrayView<float> OutValues, float InInvPeriod, float InPeriodA, float InPeriodB);
+				void (*ArrayScale)(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale);
+			};
+
+			extern const FBlockKernels BaselineBlockKernels;
+
+#if METASOUND_EXTENSIONS_MATH_WITH_AVX
+			extern const FBlockKernels Avx2BlockKernels;
+			extern const FBlockKernels Avx512BlockKernels;
+#endif
+
+#if METASOUND_EXTENSIONS_MATH_WITH_ISPC
+			extern const FBlockKernels IspcBlockKernels;
+#endif
+
+			/** Kernels for the tier chosen by SetVectorTier, or the ISPC kernels while SetUseIspcKernels is on. Always
+			 *  points at a complete table, so a swap while audio is rendering only changes where the next block runs. */
+			extern std::atomic<const FBlockKernels*> ActiveBlockKernels;
+
+			FORCEINLINE const FBlockKernels& GetBlockKernels()
+			{
+				return *ActiveBlockKernels.load(std::memory_order_relaxed);
+			}
+		}
+	}
+}
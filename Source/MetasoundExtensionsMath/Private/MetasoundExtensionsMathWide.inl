@@ -0,0 +1,260 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+// Block kernels written once against a vector operations type, and included by each wide tier's translation unit after
+// it has enabled that tier's instructions. Every kernel mirrors its 4-wide counterpart in MetasoundExtensionsMath.cpp
+// step for step, so the tiers differ only in rounding: the wide tiers always fuse multiply-adds.
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace MathPrivate
+		{
+			namespace WideKernels
+			{
+				template <typename Ops>
+				FORCEINLINE typename Ops::FRegister ClampUnit(const typename Ops::FRegister InValue)
+				{
+					return Ops::Min(Ops::Set(1.0f), Ops::Max(Ops::Set(-1.0f), InValue));
+				}
+
+				template <typename Ops>
+				FORCEINLINE typename Ops::FRegister Sin(const typename Ops::FRegister InX)
+				{
+					using FRegister = typename Ops::FRegister;
+
+					const FRegister Half = Ops::Set(0.5f);
+					const FRegister One = Ops::Set(1.0f);
+
+					const FRegister Quadrant = Ops::Floor(Ops::MultiplyAdd(InX, Ops::Set(TwoOverPi), Half));
+
+					FRegister R = Ops::MultiplyAdd(Quadrant, Ops::Set(-PiOverTwoA), InX);
+					R = Ops::MultiplyAdd(Quadrant, Ops::Set(-PiOverTwoB), R);
+					R = Ops::MultiplyAdd(Quadrant, Ops::Set(-PiOverTwoC), R);
+
+					const FRegister Z = Ops::Multiply(R, R);
+
+					FRegister SinValue = Ops::MultiplyAdd(Z, Ops::Set(SinC7), Ops::Set(SinC5));
+					SinValue = Ops::MultiplyAdd(Z, SinValue, Ops::Set(SinC3));
+					SinValue = Ops::MultiplyAdd(Ops::Multiply(R, Z), SinValue, R);
+
+					FRegister CosValue = Ops::MultiplyAdd(Z, Ops::Set(CosC8), Ops::Set(CosC6));
+					CosValue = Ops::MultiplyAdd(Z, CosValue, Ops::Set(CosC4));
+					CosValue = Ops::MultiplyAdd(Ops::Multiply(Z, Z), CosValue, Ops::MultiplyAdd(Z, Ops::Set(-0.5f), One));
+
+					const FRegister Q = Ops::MultiplyAdd(Ops::Floor(Ops::Multiply(Quadrant, Ops::Set(0.25f))), Ops::Set(-4.0f), Quadrant);
+					const FRegister Negate = Ops::Floor(Ops::Multiply(Q, Half));
+					const FRegister UseCos = Ops::MultiplyAdd(Negate, Ops::Set(-2.0f), Q);
+
+					const FRegister Value = Ops::MultiplyAdd(UseCos, Ops::Subtract(CosValue, SinValue), SinValue);
+					return ClampUnit<Ops>(Ops::Multiply(Value, Ops::MultiplyAdd(Negate, Ops::Set(-2.0f), One)));
+				}
+
+				template <typename Ops, bool bFast>
+				FORCEINLINE void SinCos(const typename Ops::FRegister InX, typename Ops::FRegister& OutSin, typename Ops::FRegister& OutCos)
+				{
+					using FRegister = typename Ops::FRegister;
+
+					const FRegister Half = Ops::Set(0.5f);
+					const FRegister Quarter = Ops::Set(0.25f);
+					const FRegister One = Ops::Set(1.0f);
+					const FRegister MinusTwo = Ops::Set(-2.0f);
+					const FRegister MinusFour = Ops::Set(-4.0f);
+
+					const FRegister Quadrant = Ops::Floor(Ops::MultiplyAdd(InX, Ops::Set(TwoOverPi), Half));
+
+					FRegister R = Ops::MultiplyAdd(Quadrant, Ops::Set(-PiOverTwoA), InX);
+					R = Ops::MultiplyAdd(Quadrant, Ops::Set(-PiOverTwoB), R);
+					R = Ops::MultiplyAdd(Quadrant, Ops::Set(-PiOverTwoC), R);
+
+					const FRegister Z = Ops::Multiply(R, R);
+					FRegister SinValue;
+					FRegister CosValue;
+					if constexpr (bFast)
+					{
+						SinValue = Ops::MultiplyAdd(Z, Ops::Set(FastSinCosS5), Ops::Set(FastSinCosS3));
+						SinValue = Ops::MultiplyAdd(Ops::Multiply(R, Z), SinValue, R);
+
+						CosValue = Ops::MultiplyAdd(Z, Ops::Set(FastSinCosC4), Ops::Set(FastSinCosC2));
+						CosValue = Ops::MultiplyAdd(Z, CosValue, One);
+					}
+					else
+					{
+						SinValue = Ops::MultiplyAdd(Z, Ops::Set(SinC7), Ops::Set(SinC5));
+						SinValue = Ops::MultiplyAdd(Z, SinValue, Ops::Set(SinC3));
+						SinValue = Ops::MultiplyAdd(Ops::Multiply(R, Z), SinValue, R);
+
+						CosValue = Ops::MultiplyAdd(Z, Ops::Set(CosC8), Ops::Set(CosC6));
+						CosValue = Ops::MultiplyAdd(Z, CosValue, Ops::Set(CosC4));
+						CosValue = Ops::MultiplyAdd(Ops::Multiply(Z, Z), CosValue, Ops::MultiplyAdd(Z, Ops::Set(-0.5f), One));
+					}
+
+					const FRegister Q = Ops::MultiplyAdd(Ops::Floor(Ops::Multiply(Quadrant, Quarter)), MinusFour, Quadrant);
+					const FRegister NegateSin = Ops::Floor(Ops::Multiply(Q, Half));
+					const FRegister Swap = Ops::MultiplyAdd(NegateSin, MinusTwo, Q);
+					const FRegister QPlusOne = Ops::Add(Q, One);
+					const FRegister NextQ = Ops::MultiplyAdd(Ops::Floor(Ops::Multiply(QPlusOne, Quarter)), MinusFour, QPlusOne);
+					const FRegister NegateCos = Ops::Floor(Ops::Multiply(NextQ, Half));
+
+					const FRegister Difference = Ops::Subtract(CosValue, SinValue);
+					OutSin = ClampUnit<Ops>(Ops::Multiply(Ops::MultiplyAdd(Swap, Difference, SinValue), Ops::MultiplyAdd(NegateSin, MinusTwo, One)));
+					OutCos = ClampUnit<Ops>(Ops::Multiply(Ops::MultiplyAdd(Ops::Negate(Swap), Difference, CosValue), Ops::MultiplyAdd(NegateCos, MinusTwo, One)));
+				}
+
+				template <typename Ops>
+				FORCEINLINE typename Ops::FRegister FastSin(const typename Ops::FRegister InX)
+				{
+					using FRegister = typename Ops::FRegister;
+
+					const FRegister Turns = Ops::Floor(Ops::MultiplyAdd(InX, Ops::Set(InvTwoPi), Ops::Set(0.5f)));
+					FRegister R = Ops::MultiplyAdd(Turns, Ops::Set(-TwoPiA), InX);
+					R = Ops::MultiplyAdd(Turns, Ops::Set(-TwoPiB), R);
+
+					const FRegister Clamped = Ops::Min(Ops::Max(R, Ops::Set(-HalfPi)), Ops::Set(HalfPi));
+					const FRegister U = Ops::MultiplyAdd(Clamped, Ops::Set(2.0f), Ops::Negate(R));
+
+					const FRegister Z = Ops::Multiply(U, U);
+					FRegister Poly = Ops::MultiplyAdd(Z, Ops::Set(FastSinC5), Ops::Set(FastSinC3));
+					Poly = Ops::MultiplyAdd(Z, Poly, Ops::Set(FastSinC1));
+					return ClampUnit<Ops>(Ops::Multiply(U, Poly));
+				}
+
+				template <typename Ops>
+				void ArraySinFast(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+				{
+					check(InValues.Num() == OutValues.Num());
+
+					const int32 Num = InValues.Num();
+					const int32 NumVectorized = Num - (Num % Ops::NumFloats);
+					const float* InData = InValues.GetData();
+					float* OutData = OutValues.GetData();
+
+					const typename Ops::FRegister Scale = Ops::Set(InScale);
+					for (int32 i = 0; i < NumVectorized; i += Ops::NumFloats)
+					{
+						Ops::Store(FastSin<Ops>(Ops::Multiply(Ops::Load(&InData[i]), Scale)), &OutData[i]);
+					}
+
+					for (int32 i = NumVectorized; i < Num; ++i)
+					{
+						OutData[i] = FastSinScalar(InData[i] * InScale);
+					}
+				}
+
+				template <typename Ops>
+				void ArraySinBalanced(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+				{
+					check(InValues.Num() == OutValues.Num());
+
+					const int32 Num = InValues.Num();
+					const int32 NumVectorized = Num - (Num % Ops::NumFloats);
+					const float* InData = InValues.GetData();
+					float* OutData = OutValues.GetData();
+
+					const typename Ops::FRegister Scale = Ops::Set(InScale);
+					for (int32 i = 0; i < NumVectorized; i += Ops::NumFloats)
+					{
+						Ops::Store(Sin<Ops>(Ops::Multiply(Ops::Load(&InData[i]), Scale)), &OutData[i]);
+					}
+
+					for (int32 i = NumVectorized; i < Num; ++i)
+					{
+						OutData[i] = SinScalar(InData[i] * InScale);
+					}
+				}
+
+				template <typename Ops, bool bFast>
+				void ArraySinCos(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale)
+				{
+					check(InValues.Num() == OutSinValues.Num());
+					check(InValues.Num() == OutCosValues.Num());
+
+					const int32 Num = InValues.Num();
+					const int32 NumVectorized = Num - (Num % Ops::NumFloats);
+					const float* InData = InValues.GetData();
+					float* OutSinData = OutSinValues.GetData();
+					float* OutCosData = OutCosValues.GetData();
+
+					const typename Ops::FRegister Scale = Ops::Set(InScale);
+					for (int32 i = 0; i < NumVectorized; i += Ops::NumFloats)
+					{
+						typename Ops::FRegister SinValue;
+						typename Ops::FRegister CosValue;
+						SinCos<Ops, bFast>(Ops::Multiply(Ops::Load(&InData[i]), Scale), SinValue, CosValue);
+
+						Ops::Store(SinValue, &OutSinData[i]);
+						Ops::Store(CosValue, &OutCosData[i]);
+					}
+
+					for (int32 i = NumVectorized; i < Num; ++i)
+					{
+						SinCosScalar<bFast>(InData[i] * InScale, OutSinData[i], OutCosData[i]);
+					}
+				}
+
+				template <typename Ops>
+				void ArrayUnwind(TArrayView<const float> InValues, TArrayView<float> OutValues, const float InInvPeriod, const float InPeriodA, const float InPeriodB)
+				{
+					using FRegister = typename Ops::FRegister;
+
+					check(InValues.Num() == OutValues.Num());
+
+					const int32 Num = InValues.Num();
+					const int32 NumVectorized = Num - (Num % Ops::NumFloats);
+					const float* InData = InValues.GetData();
+					float* OutData = OutValues.GetData();
+
+					const FRegister Half = Ops::Set(0.5f);
+					const FRegister InvPeriod = Ops::Set(InInvPeriod);
+					const FRegister NegPeriodA = Ops::Set(-InPeriodA);
+					const FRegister NegPeriodB = Ops::Set(-InPeriodB);
+					for (int32 i = 0; i < NumVectorized; i += Ops::NumFloats)
+					{
+						const FRegister X = Ops::Load(&InData[i]);
+						const FRegister Turns = Ops::Floor(Ops::MultiplyAdd(X, InvPeriod, Half));
+						Ops::Store(Ops::MultiplyAdd(Turns, NegPeriodB, Ops::MultiplyAdd(Turns, NegPeriodA, X)), &OutData[i]);
+					}
+
+					for (int32 i = NumVectorized; i < Num; ++i)
+					{
+						OutData[i] = UnwindScalar(InData[i], InInvPeriod, InPeriodA, InPeriodB);
+					}
+				}
+
+				template <typename Ops>
+				void ArrayScale(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+				{
+					check(InValues.Num() == OutValues.Num());
+
+					const int32 Num = InValues.Num();
+					const int32 NumVectorized = Num - (Num % Ops::NumFloats);
+					const float* InData = InValues.GetData();
+					float* OutData = OutValues.GetData();
+
+					const typename Ops::FRegister Scale = Ops::Set(InScale);
+					for (int32 i = 0; i < NumVectorized; i += Ops::NumFloats)
+					{
+						Ops::Store(Ops::Multiply(Ops::Load(&InData[i]), Scale), &OutData[i]);
+					}
+
+					for (int32 i = NumVectorized; i < Num; ++i)
+					{
+						OutData[i] = InData[i] * InScale;
+					}
+				}
+
+				template <typename Ops>
+				constexpr FBlockKernels MakeBlockKernels()
+				{
+					return FBlockKernels{
+						&ArraySinFast<Ops>,
+						&ArraySinBalanced<Ops>,
+						&ArraySinCos<Ops, true>,
+						&ArraySinCos<Ops, false>,
+						&ArrayUnwind<Ops>,
+						&ArrayScale<Ops>};
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,225 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsSineTable.h"
+
+#include "HAL/UnrealMemory.h"
+#include "Math/UnrealMathUtility.h"
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace SineTablePrivate
+		{
+			constexpr int32 MinTableSize = 64;
+			constexpr int32 MaxTableSize = 1 << 20;
+
+			// One guard entry before and two after the period, so cubic interpolation never has to wrap.
+			constexpr int32 NumGuardEntries = 3;
+
+			constexpr float InvTwoPi = 0.15915494309189534f;
+			constexpr float TwoPiA = 6.28125f;
+			constexpr float TwoPiB = 1.9353071795864769e-3f;
+
+			/** Entry i of the period lives at Table[i + 1]. Written once in InitializeSineTable, read-only afterwards. */
+			const float* Table = nullptr;
+			int32 TableSize = 0;
+			int32 TableMask = 0;
+			float TableScale = 0.0f;
+
+			/** Returns the period index and the fractional position between it and the next entry. */
+			FORCEINLINE int32 GetTablePosition(const float InX, float& OutFraction)
+			{
+				// Reduce in radians first so large phases keep their fractional precision.
+				const float Turns = FMath::FloorToFloat(InX * InvTwoPi + 0.5f);
+				const float R = (InX - Turns * TwoPiA) - Turns * TwoPiB;
+
+				float Phase = R * InvTwoPi;
+				Phase -= FMath::FloorToFloat(Phase);
+
+				const float Position = Phase * TableScale;
+				const int32 Index = static_cast<int32>(Position);
+				OutFraction = Position - static_cast<float>(Index);
+
+				return Index & TableMask;
+			}
+
+			FORCEINLINE float InterpolateLinear(const int32 InIndex, const float InFraction)
+			{
+				const float* Entry = &Table[InIndex + 1];
+				return Entry[0] + InFraction * (Entry[1] - Entry[0]);
+			}
+
+			FORCEINLINE float InterpolateCubic(const int32 InIndex, const float InFraction)
+			{
+				const float* Entry = &Table[InIndex];
+
+				const float Y0 = Entry[0];
+				const float Y1 = Entry[1];
+				const float Y2 = Entry[2];
+				const float Y3 = Entry[3];
+
+				const float C1 = Y2 - Y0;
+				const float C2 = 2.0f * Y0 - 5.0f * Y1 + 4.0f * Y2 - Y3;
+				const float C3 = 3.0f * (Y1 - Y2) + Y3 - Y0;
+
+				return Y1 + 0.5f * InFraction * (C1 + InFraction * (C2 + InFraction * C3));
+			}
+
+			FORCEINLINE float LookupLinear(const float InX)
+			{
+				float Fraction = 0.0f;
+				const int32 Index = GetTablePosition(InX, Fraction);
+
+				return InterpolateLinear(Index, Fraction);
+			}
+
+			FORCEINLINE float LookupCubic(const float InX)
+			{
+				float Fraction = 0.0f;
+				const int32 Index = GetTablePosition(InX, Fraction);
+
+				return InterpolateCubic(Index, Fraction);
+			}
+
+			FORCEINLINE void LookupSinCosLinear(const float InX, float& OutSin, float& OutCos)
+			{
+				float Fraction = 0.0f;
+				const int32 Index = GetTablePosition(InX, Fraction);
+
+				OutSin = InterpolateLinear(Index, Fraction);
+				OutCos = InterpolateLinear((Index + (TableSize >> 2)) & TableMask, Fraction);
+			}
+
+			FORCEINLINE void LookupSinCosCubic(const float InX, float& OutSin, float& OutCos)
+			{
+				float Fraction = 0.0f;
+				const int32 Index = GetTablePosition(InX, Fraction);
+
+				OutSin = InterpolateCubic(Index, Fraction);
+				OutCos = InterpolateCubic((Index + (TableSize >> 2)) & TableMask, Fraction);
+			}
+		}
+
+		void InitializeSineTable(int32 InSize)
+		{
+			using namespace SineTablePrivate;
+
+			check(nullptr == Table);
+
+			const int32 Size = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Clamp(InSize, MinTableSize, MaxTableSize))));
+			float* NewTable = static_cast<float*>(FMemory::Malloc((Size + NumGuardEntries) * sizeof(float), PLATFORM_CACHE_LINE_SIZE));
+
+			for (int32 i = -1; i <= Size + 1; ++i)
+			{
+				NewTable[i + 1] = static_cast<float>(FMath::Sin(UE_DOUBLE_TWO_PI * static_cast<double>(i) / static_cast<double>(Size)));
+			}
+
+			Table = NewTable;
+			TableSize = Size;
+			TableMask = Size - 1;
+			TableScale = static_cast<float>(Size);
+		}
+
+		void ReleaseSineTable()
+		{
+			using namespace SineTablePrivate;
+
+			FMemory::Free(const_cast<float*>(Table));
+			Table = nullptr;
+			TableSize = 0;
+			TableMask = 0;
+			TableScale = 0.0f;
+		}
+
+		bool IsSineTableInitialized()
+		{
+			return nullptr != SineTablePrivate::Table;
+		}
+
+		int32 GetSineTableSize()
+		{
+			return SineTablePrivate::TableSize;
+		}
+
+		float SinTableLinear(float InX)
+		{
+			return SineTablePrivate::LookupLinear(InX);
+		}
+
+		float SinTableCubic(float InX)
+		{
+			return SineTablePrivate::LookupCubic(InX);
+		}
+
+		void ArraySinTableLinear(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+		{
+			check(InValues.Num() == OutValues.Num());
+
+			const int32 Num = InValues.Num();
+			const float* InData = InValues.GetData();
+			float* OutData = OutValues.GetData();
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				OutData[i] = SineTablePrivate::LookupLinear(InData[i] * InScale);
+			}
+		}
+
+		void ArraySinTableCubic(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+		{
+			check(InValues.Num() == OutValues.Num());
+
+			const int32 Num = InValues.Num();
+			const float* InData = InValues.GetData();
+			float* OutData = OutValues.GetData();
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				OutData[i] = SineTablePrivate::LookupCubic(InData[i] * InScale);
+			}
+		}
+
+		void SinCosTableLinear(float InX, float& OutSin, float& OutCos)
+		{
+			SineTablePrivate::LookupSinCosLinear(InX, OutSin, OutCos);
+		}
+
+		void SinCosTableCubic(float InX, float& OutSin, float& OutCos)
+		{
+			SineTablePrivate::LookupSinCosCubic(InX, OutSin, OutCos);
+		}
+
+		void ArraySinCosTableLinear(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale)
+		{
+			check(InValues.Num() == OutSinValues.Num());
+			check(InValues.Num() == OutCosValues.Num());
+
+			const int32 Num = InValues.Num();
+			const float* InData = InValues.GetData();
+			float* OutSinData = OutSinValues.GetData();
+			float* OutCosData = OutCosValues.GetData();
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				SineTablePrivate::LookupSinCosLinear(InData[i] * InScale, OutSinData[i], OutCosData[i]);
+			}
+		}
+
+		void ArraySinCosTableCubic(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale)
+		{
+			check(InValues.Num() == OutSinValues.Num());
+			check(InValues.Num() == OutCosValues.Num());
+
+			const int32 Num = InValues.Num();
+			const float* InData = InValues.GetData();
+			float* OutSinData = OutSinValues.GetData();
+			float* OutCosData = OutCosValues.GetData();
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				SineTablePrivate::LookupSinCosCubic(InData[i] * InScale, OutSinData[i], OutCosData[i]);
+			}
+		}
+	}
+}
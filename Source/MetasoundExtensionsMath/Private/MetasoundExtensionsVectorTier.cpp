@@ -0,0 +1,204 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsMath.h"
+
+#include "MetasoundExtensionsMathKernels.h"
+
+#if METASOUND_EXTENSIONS_MATH_WITH_AVX
+#if PLATFORM_WINDOWS
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		namespace MathPrivate
+		{
+			std::atomic<const FBlockKernels*> ActiveBlockKernels{&BaselineBlockKernels};
+		}
+
+		namespace VectorTierPrivate
+		{
+			std::atomic<EVectorTier> ActiveTier{EVectorTier::Baseline};
+			std::atomic<bool> bUseIspcKernels{false};
+
+#if METASOUND_EXTENSIONS_MATH_WITH_AVX
+			struct FCpuidRegisters
+			{
+				uint32 Eax = 0;
+				uint32 Ebx = 0;
+				uint32 Ecx = 0;
+				uint32 Edx = 0;
+			};
+
+			FCpuidRegisters Cpuid(const uint32 InLeaf, const uint32 InSubleaf)
+			{
+				FCpuidRegisters Registers;
+#if PLATFORM_WINDOWS
+				int32 Values[4];
+				__cpuidex(Values, static_cast<int32>(InLeaf), static_cast<int32>(InSubleaf));
+
+				Registers.Eax = static_cast<uint32>(Values[0]);
+				Registers.Ebx = static_cast<uint32>(Values[1]);
+				Registers.Ecx = static_cast<uint32>(Values[2]);
+				Registers.Edx = static_cast<uint32>(Values[3]);
+#else
+				__cpuid_count(InLeaf, InSubleaf, Registers.Eax, Registers.Ebx, Registers.Ecx, Registers.Edx);
+#endif
+				return Registers;
+			}
+
+			/** Register state the OS saves on a context switch. Only valid to read when CPUID reports OSXSAVE. */
+			uint64 ReadXcr0()
+			{
+#if PLATFORM_WINDOWS
+				return _xgetbv(0);
+#else
+				uint32 Low = 0;
+				uint32 High = 0;
+				__asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+				return (static_cast<uint64>(High) << 32) | Low;
+#endif
+			}
+
+			/** A CPU can report AVX2 or AVX-512 while the OS does not save the wider registers, in which case using them
+			 *  faults or silently corrupts state, so both the instruction bits and XCR0 are checked. */
+			EVectorTier DetectVectorTier()
+			{
+				if (Cpuid(0, 0).Eax < 7)
+				{
+					return EVectorTier::Baseline;
+				}
+
+				const FCpuidRegisters Features = Cpuid(1, 0);
+				const bool bHasFma = 0 != (Features.Ecx & (1u << 12));
+				const bool bHasOsxsave = 0 != (Features.Ecx & (1u << 27));
+				const bool bHasAvx = 0 != (Features.Ecx & (1u << 28));
+				if (!bHasFma || !bHasOsxsave || !bHasAvx)
+				{
+					return EVectorTier::Baseline;
+				}
+
+				// Bits 1-2 are the SSE and AVX state, bits 5-7 the AVX-512 mask and upper register state.
+				const uint64 Xcr0 = ReadXcr0();
+				const bool bOsSavesAvx = 0x6 == (Xcr0 & 0x6);
+				const bool bOsSavesAvx512 = 0xE6 == (Xcr0 & 0xE6);
+
+				const FCpuidRegisters ExtendedFeatures = Cpuid(7, 0);
+				const bool bHasAvx2 = 0 != (ExtendedFeatures.Ebx & (1u << 5));
+				const bool bHasAvx512F = 0 != (ExtendedFeatures.Ebx & (1u << 16));
+
+				if (bHasAvx2 && bHasAvx512F && bOsSavesAvx512)
+				{
+					return EVectorTier::Avx512;
+				}
+
+				if (bHasAvx2 && bOsSavesAvx)
+				{
+					return EVectorTier::Avx2;
+				}
+
+				return EVectorTier::Baseline;
+			}
+#endif
+
+			const MathPrivate::FBlockKernels& GetBlockKernelsForTier(const EVectorTier InTier)
+			{
+				switch (InTier)
+				{
+#if METASOUND_EXTENSIONS_MATH_WITH_AVX
+					case EVectorTier::Avx512:
+						return MathPrivate::Avx512BlockKernels;
+
+					case EVectorTier::Avx2:
+						return MathPrivate::Avx2BlockKernels;
+#endif
+
+					case EVectorTier::Baseline:
+					default:
+						return MathPrivate::BaselineBlockKernels;
+				}
+			}
+
+			void UpdateActiveBlockKernels()
+			{
+				const MathPrivate::FBlockKernels* Kernels = &GetBlockKernelsForTier(ActiveTier.load(std::memory_order_relaxed));
+
+#if METASOUND_EXTENSIONS_MATH_WITH_ISPC
+				if (bUseIspcKernels.load(std::memory_order_relaxed))
+				{
+					Kernels = &MathPrivate::IspcBlockKernels;
+				}
+#endif
+
+				MathPrivate::ActiveBlockKernels.store(Kernels, std::memory_order_relaxed);
+			}
+		}
+
+		const TCHAR* LexToString(EVectorTier InTier)
+		{
+			switch (InTier)
+			{
+				case EVectorTier::Baseline:
+					return TEXT("Baseline");
+				case EVectorTier::Avx2:
+					return TEXT("Avx2");
+				case EVectorTier::Avx512:
+					return TEXT("Avx512");
+				default:
+					return TEXT("Unknown");
+			}
+		}
+
+		EVectorTier GetSupportedVectorTier()
+		{
+#if METASOUND_EXTENSIONS_MATH_WITH_AVX
+			static const EVectorTier SupportedTier = VectorTierPrivate::DetectVectorTier();
+			return SupportedTier;
+#else
+			return EVectorTier::Baseline;
+#endif
+		}
+
+		EVectorTier GetVectorTier()
+		{
+			return VectorTierPrivate::ActiveTier.load(std::memory_order_relaxed);
+		}
+
+		EVectorTier SetVectorTier(EVectorTier InTier)
+		{
+			using namespace VectorTierPrivate;
+
+			const EVectorTier Tier = FMath::Min(InTier, GetSupportedVectorTier());
+
+			ActiveTier.store(Tier, std::memory_order_relaxed);
+			UpdateActiveBlockKernels();
+
+			return Tier;
+		}
+
+		bool HasIspcKernels()
+		{
+			return METASOUND_EXTENSIONS_MATH_WITH_ISPC != 0;
+		}
+
+		bool IsUsingIspcKernels()
+		{
+			return VectorTierPrivate::bUseIspcKernels.load(std::memory_order_relaxed);
+		}
+
+		bool SetUseIspcKernels(bool bInUseIspc)
+		{
+			using namespace VectorTierPrivate;
+
+			bUseIspcKernels.store(bInUseIspc && HasIspcKernels(), std::memory_order_relaxed);
+			UpdateActiveBlockKernels();
+
+			return IsUsingIspcKernels();
+		}
+	}
+}
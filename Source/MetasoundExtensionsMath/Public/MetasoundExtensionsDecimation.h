@@ -0,0 +1,49 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "MetasoundExtensionsMath.h"
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		/** EDecimationInterpolation
+		 *
+		 *  How the decimated block functions fill the frames between two evaluated frames, where h is the phase in
+		 *  radians the input moves between them. For example, a 100 Hz phase at 48 kHz with a stride of 16 moves 0.21
+		 *  radians per stride.
+		 *
+		 *  Linear   Straight line between the two values. Max error h^2 / 8 (5.5e-3 in the example).
+		 *  Cubic    Hermite curve through both values, with slopes from the cosine at each end. Max error h^4 / 384
+		 *           (5.0e-6 in the example), for the cost of one extra multiply-add per frame.
+		 */
+		enum class EDecimationInterpolation : uint8
+		{
+			Linear,
+			Cubic
+		};
+
+		METASOUNDEXTENSIONSMATH_API const TCHAR* LexToString(EDecimationInterpolation InInterpolation);
+
+		/** Largest stride the decimated block functions accept; larger values are clamped to it. */
+		constexpr int32 MaxDecimationStride = 256;
+
+		/** ArraySinDecimated
+		 *
+		 *  Computes sin(InValues[i] * InScale) exactly on every InStride-th frame and on the last frame of the block, and
+		 *  interpolates the frames in between with a vectorized ramp. Each block starts and ends on an evaluated frame,
+		 *  so no state carries across blocks.
+		 *
+		 *  InPrecision picks the kernel for the evaluated frames. A stride of 1 or less evaluates every frame through
+		 *  that kernel's block function. The phase between two evaluated frames is taken the short way round, so a
+		 *  wrapping phase input is followed correctly as long as it moves less than half a turn per stride. Faster
+		 *  inputs alias; decimation is meant for modulation signals. InValues and OutValues may alias.
+		 */
+		METASOUNDEXTENSIONSMATH_API void ArraySinDecimated(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale, int32 InStride, EDecimationInterpolation InInterpolation, ETrigPrecision InPrecision);
+
+		/** Sine and cosine form of ArraySinDecimated, sharing the evaluated frames between both outputs. */
+		METASOUNDEXTENSIONSMATH_API void ArraySinCosDecimated(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale, int32 InStride, EDecimationInterpolation InInterpolation, ETrigPrecision InPrecision);
+	}
+}
@@ -0,0 +1,384 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "Math/UnrealMathUtility.h"
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		/** ETrigPrecision
+		 *
+		 *  Accuracy/cost trade-off for trig evaluation, chosen once when an operator is created.
+		 *  Max absolute error against a double precision reference for |x| <= 8192 radians:
+		 *
+		 *  Fast         6.8e-5   Degree 5 minimax polynomial on [-PI/2, PI/2].
+		 *  Balanced     1.5e-7   Degree 7 sin and degree 8 cos minimax polynomials on [-PI/4, PI/4].
+		 *  Exact        1 ulp    Platform libm through FMath.
+		 *  TableLinear  5.2e-7   Shared sine table, linear interpolation (7.5e-5 with a 256 entry table).
+		 *  TableCubic   5.3e-7   Shared sine table, Catmull-Rom interpolation (7.5e-7 with a 256 entry table).
+		 *
+		 *  Table errors are for the default 4096 entry table. Beyond |x| = 8192 the approximations lose phase accuracy,
+		 *  but every mode still returns a value in [-1, 1], and NaN or infinite input returns NaN. New modes are appended
+		 *  so serialized values stay valid.
+		 */
+		enum class ETrigPrecision : uint8
+		{
+			Fast,
+			Balanced,
+			Exact,
+			TableLinear,
+			TableCubic
+		};
+
+		/** Every precision mode, in declaration order. */
+		constexpr ETrigPrecision AllTrigPrecisions[] = {ETrigPrecision::Fast, ETrigPrecision::Balanced, ETrigPrecision::Exact, ETrigPrecision::TableLinear, ETrigPrecision::TableCubic};
+
+		METASOUNDEXTENSIONSMATH_API const TCHAR* LexToString(ETrigPrecision InPrecision);
+
+		/** FSinKernel
+		 *
+		 *  Scalar and block sine evaluators for a single precision mode. Operators look this up once on
+		 *  creation, so the precision never costs a branch per value.
+		 */
+		struct FSinKernel
+		{
+			float (*Sin)(float InX);
+			double (*SinDouble)(double InX);
+			void (*ArraySin)(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale);
+		};
+
+		METASOUNDEXTENSIONSMATH_API const FSinKernel& GetSinKernel(ETrigPrecision InPrecision);
+
+		/** FSinCosKernel
+		 *
+		 *  Sine and cosine from a single shared range reduction, for a single precision mode. Fast uses degree 5/4
+		 *  polynomials here (max error 1.2e-5); every other mode matches the error of its FSinKernel counterpart. Exact
+		 *  reduces in double precision once and evaluates libm on the reduced angle, up to 1e6 radians.
+		 */
+		struct FSinCosKernel
+		{
+			void (*SinCos)(float InX, float& OutSin, float& OutCos);
+			void (*SinCosDouble)(double InX, double& OutSin, double& OutCos);
+			void (*ArraySinCos)(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale);
+		};
+
+		METASOUNDEXTENSIONSMATH_API const FSinCosKernel& GetSinCosKernel(ETrigPrecision InPrecision);
+
+		/** ArraySin
+		 *
+		 *  Computes sin(InValues[i] * InScale) for a whole block in a single vectorized pass, at Balanced precision.
+		 *  The scale is fused into the range reduction, so degree input only costs one extra multiply.
+		 *  InValues and OutValues must be the same length and may alias.
+		 */
+		METASOUNDEXTENSIONSMATH_API void ArraySin(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale = 1.0f);
+
+		/** SinIntegerDegrees
+		 *
+		 *  Sine of a whole number of degrees, read from a 360 entry table. Exact to float precision for every
+		 *  int32 input, with no float conversion of the angle and no trig call.
+		 */
+		METASOUNDEXTENSIONSMATH_API float SinIntegerDegrees(int32 InDegrees);
+
+		/** Sine and cosine of a whole number of degrees from the same 360 entry table as SinIntegerDegrees. */
+		METASOUNDEXTENSIONSMATH_API void SinCosIntegerDegrees(int32 InDegrees, float& OutSin, float& OutCos);
+
+		/** Wraps a whole number of degrees to [-180, 180] with the same conventions as FMath::UnwindDegrees,
+		 *  using exact integer arithmetic so inputs beyond 2^24 keep their value. */
+		FORCEINLINE int32 UnwindIntegerDegrees(int32 InDegrees)
+		{
+			int32 Wrapped = InDegrees % 360;
+			if (Wrapped > 180)
+			{
+				Wrapped -= 360;
+			}
+			else if (Wrapped < -180)
+			{
+				Wrapped += 360;
+			}
+
+			return Wrapped;
+		}
+
+		/** Wraps an angle in degrees to [-180, 180] with the same conventions as FMath::UnwindDegrees. The remainder is
+		 *  exact, so the cost does not grow with the magnitude of the input, and infinite input gives NaN instead of
+		 *  never returning. */
+		template <typename ValueType>
+		FORCEINLINE ValueType UnwindDegrees(ValueType InDegrees)
+		{
+			ValueType Wrapped = FMath::Fmod(InDegrees, static_cast<ValueType>(360.0));
+			if (Wrapped > static_cast<ValueType>(180.0))
+			{
+				Wrapped -= static_cast<ValueType>(360.0);
+			}
+			else if (Wrapped < static_cast<ValueType>(-180.0))
+			{
+				Wrapped += static_cast<ValueType>(360.0);
+			}
+
+			return Wrapped;
+		}
+
+		/** Wraps an angle in radians to [-PI, PI] with the same conventions as FMath::UnwindRadians; see UnwindDegrees. */
+		FORCEINLINE double UnwindRadians(double InRadians)
+		{
+			double Wrapped = FMath::Fmod(InRadians, UE_DOUBLE_TWO_PI);
+			if (Wrapped > UE_DOUBLE_PI)
+			{
+				Wrapped -= UE_DOUBLE_TWO_PI;
+			}
+			else if (Wrapped < -UE_DOUBLE_PI)
+			{
+				Wrapped += UE_DOUBLE_TWO_PI;
+			}
+
+			return Wrapped;
+		}
+
+		/** Float angles wrap in double precision: a remainder by the float nearest 2 * PI drifts by 1.7e-7 per turn. */
+		FORCEINLINE float UnwindRadians(float InRadians)
+		{
+			return static_cast<float>(UnwindRadians(static_cast<double>(InRadians)));
+		}
+
+		/** Folds an angle in degrees to the angle in [-90, 90] with the same sine: UnwindDegrees, then a reflection about
+		 *  +-90. Both steps are exact in degrees, so no rounding of PI / 180 is ever multiplied by a large input. */
+		FORCEINLINE double FoldSineDegrees(double InDegrees)
+		{
+			const double Wrapped = UnwindDegrees(InDegrees);
+			return 2.0 * FMath::Clamp(Wrapped, -90.0, 90.0) - Wrapped;
+		}
+
+		/** SinDegrees
+		 *
+		 *  Sine of an angle in degrees through InKernel, reduced exactly with FoldSineDegrees before conversion to
+		 *  radians. The kernel only ever sees |x| <= PI / 2, so the cost is the same and the output equally accurate for
+		 *  every input magnitude.
+		 */
+		FORCEINLINE double SinDegrees(double InDegrees, const FSinKernel& InKernel)
+		{
+			return InKernel.SinDouble(UE_DOUBLE_PI / 180.0 * FoldSineDegrees(InDegrees));
+		}
+
+		/** ArraySinDegrees
+		 *
+		 *  Block form of SinDegrees: folds each angle in place into OutValues, then runs InKernel's block sine over them.
+		 *  The fold is vectorized and matches FoldSineDegrees bit for bit for |x| <= 2^24; vectors holding a larger or
+		 *  infinite angle fold in double through FoldSineDegrees instead. NaN stays on the vector path, which carries it
+		 *  through to the output. InValues and OutValues may alias.
+		 */
+		METASOUNDEXTENSIONSMATH_API void ArraySinDegrees(TArrayView<const float> InValues, TArrayView<float> OutValues, const FSinKernel& InKernel);
+
+		/** Reduces an angle in degrees to the angle in [-45, 45] that is OutQuadrant (0 to 3) quarter turns short of it:
+		 *  UnwindDegrees, then the nearest multiple of 90 subtracted. Both steps are exact in degrees. NaN and infinite
+		 *  input give NaN. */
+		FORCEINLINE double ReduceQuarterTurnDegrees(double InDegrees, int32& OutQuadrant)
+		{
+			const double Wrapped = UnwindDegrees(InDegrees);
+			if (Wrapped >= 135.0)
+			{
+				OutQuadrant = 2;
+				return Wrapped - 180.0;
+			}
+			else if (Wrapped >= 45.0)
+			{
+				OutQuadrant = 1;
+				return Wrapped - 90.0;
+			}
+			else if (Wrapped >= -45.0)
+			{
+				OutQuadrant = 0;
+				return Wrapped;
+			}
+			else if (Wrapped >= -135.0)
+			{
+				OutQuadrant = 3;
+				return Wrapped + 90.0;
+			}
+
+			OutQuadrant = 2;
+			return Wrapped + 180.0;
+		}
+
+		/** SinCosDegrees
+		 *
+		 *  Sine and cosine of an angle in degrees through InKernel, reduced exactly with ReduceQuarterTurnDegrees before
+		 *  conversion to radians; the quadrant then swaps and negates the results. The kernel only ever sees
+		 *  |x| <= PI / 4, so both outputs are equally accurate for every input magnitude. Zero crossings are +0.
+		 */
+		FORCEINLINE void SinCosDegrees(double InDegrees, double& OutSin, double& OutCos, const FSinCosKernel& InKernel)
+		{
+			int32 Quadrant = 0;
+			const double Reduced = ReduceQuarterTurnDegrees(InDegrees, Quadrant);
+
+			double Sin = 0.0;
+			double Cos = 0.0;
+			InKernel.SinCosDouble(UE_DOUBLE_PI / 180.0 * Reduced, Sin, Cos);
+
+			// Subtracting from zero rather than negating keeps a zero at +0, as in the integer degree table.
+			switch (Quadrant)
+			{
+				case 0:
+					OutSin = Sin;
+					OutCos = Cos;
+					break;
+				case 1:
+					OutSin = Cos;
+					OutCos = 0.0 - Sin;
+					break;
+				case 2:
+					OutSin = 0.0 - Sin;
+					OutCos = 0.0 - Cos;
+					break;
+				default:
+					OutSin = 0.0 - Cos;
+					OutCos = Sin;
+					break;
+			}
+		}
+
+		/** ArraySinCosDegrees
+		 *
+		 *  Block form of SinCosDegrees. The reduction is vectorized and exact for |x| <= 2^24; vectors holding a larger or
+		 *  infinite angle reduce in double through ReduceQuarterTurnDegrees instead, and NaN carries through to both
+		 *  outputs. InValues may alias either output.
+		 */
+		METASOUNDEXTENSIONSMATH_API void ArraySinCosDegrees(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, const FSinCosKernel& InKernel);
+
+		/** ArrayScale
+		 *
+		 *  Computes InValues[i] * InScale for a whole block. When both views point at the same memory the
+		 *  block is scaled in place, so callers that own their input avoid touching a second buffer.
+		 */
+		METASOUNDEXTENSIONSMATH_API void ArrayScale(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale);
+
+		/** ArrayUnwindDegrees
+		 *
+		 *  Wraps each angle in degrees to [-180, 180) with a branch-free floor-based reduction, so the cost
+		 *  does not grow with the magnitude of the input. The remainder is exact for |x| <= 2^24, but where x / 360
+		 *  rounds across a half period the result can land one input ulp outside the range. InValues and OutValues
+		 *  may alias.
+		 */
+		METASOUNDEXTENSIONSMATH_API void ArrayUnwindDegrees(TArrayView<const float> InValues, TArrayView<float> OutValues);
+
+		/** ArrayUnwindRadians
+		 *
+		 *  Wraps each angle in radians to [-PI, PI) using the same reduction as ArrayUnwindDegrees, within 2.5e-7 of the
+		 *  exact remainder for |x| <= 8192. InValues and OutValues may alias.
+		 */
+		METASOUNDEXTENSIONSMATH_API void ArrayUnwindRadians(TArrayView<const float> InValues, TArrayView<float> OutValues);
+
+		/** EVectorTier
+		 *
+		 *  Instruction set the block kernels run on: ArraySin, ArrayScale, ArrayUnwindDegrees, ArrayUnwindRadians and the
+		 *  block entries of the Fast and Balanced FSinKernel and FSinCosKernel. Baseline is the engine's 4-wide vector
+		 *  path (SSE on x86, NEON on ARM). Avx2 and Avx512 process 8 and 16 values per instruction with fused
+		 *  multiply-adds, so their results can differ from Baseline in the last bit while staying within the same error
+		 *  bounds. The wide tiers are only built for desktop x86.
+		 */
+		enum class EVectorTier : uint8
+		{
+			Baseline,
+			Avx2,
+			Avx512
+		};
+
+		/** Every tier, in declaration order. */
+		constexpr EVectorTier AllVectorTiers[] = {EVectorTier::Baseline, EVectorTier::Avx2, EVectorTier::Avx512};
+
+		METASOUNDEXTENSIONSMATH_API const TCHAR* LexToString(EVectorTier InTier);
+
+		/** Returns the widest tier this build contains and the CPU and OS can run. Detected once and cached. */
+		METASOUNDEXTENSIONSMATH_API EVectorTier GetSupportedVectorTier();
+
+		/** Returns the tier the block kernels currently run on. Baseline until SetVectorTier is first called. */
+		METASOUNDEXTENSIONSMATH_API EVectorTier GetVectorTier();
+
+		/** Switches the block kernels to InTier, or to the supported tier if InTier is wider, and returns the tier now in
+		 *  use. Safe to call while audio is rendering; blocks already in flight finish on the previous tier. */
+		METASOUNDEXTENSIONSMATH_API EVectorTier SetVectorTier(EVectorTier InTier);
+
+		/** Whether this build contains ISPC forms of the block kernels. They are compiled when the target enables ISPC. */
+		METASOUNDEXTENSIONSMATH_API bool HasIspcKernels();
+
+		/** Whether the block kernels currently run through ISPC instead of the vector tier's own code. */
+		METASOUNDEXTENSIONSMATH_API bool IsUsingIspcKernels();
+
+		/** Switches the block kernels between ISPC, which picks its own instruction set at run time, and the vector
+		 *  tier's own code. Has no effect without HasIspcKernels. Returns whether the ISPC kernels are now in use. */
+		METASOUNDEXTENSIONSMATH_API bool SetUseIspcKernels(bool bInUseIspc);
+
+		/** FRotationOscillator
+		 *
+		 *  Sine generator that advances a unit phasor by a fixed complex rotation each sample, so a sample costs a few
+		 *  multiply-adds instead of a sine call. Four consecutive samples are rotated together in one vector register.
+		 *  Float rounding slowly pulls the phasor off the unit circle and off its true phase, so the exact phase is
+		 *  tracked in double precision alongside it and Resync should be called once per block to snap the phasor back.
+		 */
+		class METASOUNDEXTENSIONSMATH_API FRotationOscillator
+		{
+		public:
+			/** Moves the oscillator to the given phase in radians. */
+			void SetPhase(double InRadians);
+
+			/** Phase in radians of the next sample Generate will write, wrapped to [0, 2 * PI). */
+			double GetPhase() const { return Phase; }
+
+			/** Sets the phase increment per sample, in radians. */
+			void SetStep(double InRadiansPerSample);
+
+			/** Writes the sine of the next OutValues.Num() phases and advances past them. */
+			void Generate(TArrayView<float> OutValues);
+
+			/** Rebuilds the phasor from the double precision phase, removing accumulated amplitude and phase drift. */
+			void Resync();
+
+		private:
+			double Phase = 0.0;
+			double Step = 0.0;
+
+			float PhasorCos = 1.0f;
+			float PhasorSin = 0.0f;
+
+			// Rotation by 1, 2, 3 and 4 samples. The first three fan the phasor out across the lanes of a vector, the
+			// last advances all lanes together.
+			float StepCos[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+			float StepSin[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+		};
+
+		/** FTimePhase
+		 *
+		 *  Phase of sin(2 * PI * f * t) for a time input, held in double precision turns wrapped to [0, 1). Each update
+		 *  advances the phase by the frequency times the time elapsed since the previous one, instead of recomputing
+		 *  f * t. The rounding error per update then only depends on the wrapped phase and that step, so it stays the same
+		 *  after days of uptime. A frequency change also continues from the current phase instead of jumping.
+		 */
+		class METASOUNDEXTENSIONSMATH_API FTimePhase
+		{
+		public:
+			/** Restarts the phase at InFrequency * InSeconds. */
+			void Reset(double InSeconds, double InFrequency);
+
+			/** Advances the phase to InSeconds at the frequency given by the previous call, then switches to InFrequency
+			 *  for the next one. Returns whether the phase moved. */
+			bool Advance(double InSeconds, double InFrequency);
+
+			/** Current phase in turns, in [0, 1). */
+			double GetTurns() const { return Turns; }
+
+			/** Current phase in radians, in [0, 2 * PI). */
+			double GetRadians() const { return UE_DOUBLE_TWO_PI * Turns; }
+
+			/** Time the last Advance covered, in seconds. Zero after Reset and while the time stands still. */
+			double GetElapsedSeconds() const { return Elapsed; }
+
+		private:
+			double Turns = 0.0;
+			double Seconds = 0.0;
+			double Frequency = 0.0;
+			double Elapsed = 0.0;
+		};
+	}
+}
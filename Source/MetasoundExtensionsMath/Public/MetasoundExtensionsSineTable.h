@@ -0,0 +1,42 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+
+namespace Metasound
+{
+	namespace ExtensionsMath
+	{
+		/** Default number of entries in the shared sine table. */
+		constexpr int32 DefaultSineTableSize = 4096;
+
+		/** Builds the process-wide sine table shared by every operator. InSize is clamped to [64, 1 << 20] and
+		 *  rounded up to a power of two. Must be called before any operator uses a table precision mode. */
+		METASOUNDEXTENSIONSMATH_API void InitializeSineTable(int32 InSize);
+
+		/** Frees the shared sine table. Only call once no operator can still be evaluating through it. */
+		METASOUNDEXTENSIONSMATH_API void ReleaseSineTable();
+
+		METASOUNDEXTENSIONSMATH_API bool IsSineTableInitialized();
+
+		/** Returns the number of entries in one period of the shared table, or 0 if it has not been built. */
+		METASOUNDEXTENSIONSMATH_API int32 GetSineTableSize();
+
+		/** Table sine with linear interpolation between entries. */
+		METASOUNDEXTENSIONSMATH_API float SinTableLinear(float InX);
+
+		/** Table sine with cubic (Catmull-Rom) interpolation across four entries. */
+		METASOUNDEXTENSIONSMATH_API float SinTableCubic(float InX);
+
+		/** Table sine and cosine from one lookup position; the cosine reads a quarter period further along. */
+		METASOUNDEXTENSIONSMATH_API void SinCosTableLinear(float InX, float& OutSin, float& OutCos);
+		METASOUNDEXTENSIONSMATH_API void SinCosTableCubic(float InX, float& OutSin, float& OutCos);
+
+		/** Block forms of the table lookups. InValues and OutValues may alias. */
+		METASOUNDEXTENSIONSMATH_API void ArraySinTableLinear(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale);
+		METASOUNDEXTENSIONSMATH_API void ArraySinTableCubic(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale);
+		METASOUNDEXTENSIONSMATH_API void ArraySinCosTableLinear(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale);
+		METASOUNDEXTENSIONSMATH_API void ArraySinCosTableCubic(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, float InScale);
+	}
+}
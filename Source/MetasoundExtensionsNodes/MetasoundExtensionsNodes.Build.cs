@@ -11,6 +11,7 @@ public class MetasoundExtensionsNodes : ModuleRules
 			{
 				"AudioExtensions",
 				"Core",
+				"MetasoundExtensionsMath",
 				"MetasoundFrontend",
 				"MetasoundStandardNodes",
 				"Serialization",
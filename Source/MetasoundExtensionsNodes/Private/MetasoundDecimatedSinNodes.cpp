@@ -0,0 +1,299 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundExtensionsDecimation.h"
+#include "MetasoundExtensionsInputCache.h"
+#include "MetasoundExtensionsMath.h"
+#include "MetasoundExtensionsNodeStats.h"
+#include "MetasoundExtensionsTrigPrecision.h"
+#include "MetasoundExtensionsUnaryMathNode.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_DecimatedSinNodes"
+
+namespace Metasound
+{
+	namespace DecimatedSinVertexNames
+	{
+		METASOUND_PARAM(InputValue, "Input", "Input value.");
+		METASOUND_PARAM(InputPrecision, "Precision", "Accuracy of the evaluated frames. The interpolation error between them is usually far larger, so Balanced is rarely worth raising.");
+		METASOUND_PARAM(InputDecimation, "Decimation", "Number of frames per evaluation, up to 256. The frames in between are interpolated; 1 evaluates every frame.");
+		METASOUND_PARAM(InputInterpolation, "Interpolation", "How the frames between evaluations are filled.");
+		METASOUND_PARAM(OutputValue, "Value", "The solved sine of the input.");
+		METASOUND_PARAM(OutputSin, "Sin", "The solved sine of the input.");
+		METASOUND_PARAM(OutputCos, "Cos", "The solved cosine of the input.");
+	}
+
+	namespace MetasoundDecimatedSinNodePrivate
+	{
+		constexpr int32 DefaultDecimation = 16;
+
+		/** Each family keeps the class namespace of its full-rate nodes, so the decimated variants sit next to them. */
+		struct FDecimatedSin
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bSinCos = false;
+			static constexpr float Scale = 1.0f;
+
+			static FName GetFamilyName() { return TEXT("Sin"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("DecimatedSinName", "Sin (Audio, Decimated)"); }
+		};
+
+		struct FDecimatedDegSin
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bSinCos = false;
+			static constexpr float Scale = UE_PI / 180.0f;
+
+			static FName GetFamilyName() { return TEXT("DegSin"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("DecimatedDegSinName", "Sin (degrees) (Audio, Decimated)"); }
+		};
+
+		struct FDecimatedSinCos
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bSinCos = true;
+			static constexpr float Scale = 1.0f;
+
+			static FName GetFamilyName() { return TEXT("SinCos"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("DecimatedSinCosName", "SinCos (Audio, Decimated)"); }
+		};
+
+		struct FDecimatedDegSinCos
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bSinCos = true;
+			static constexpr float Scale = UE_PI / 180.0f;
+
+			static FName GetFamilyName() { return TEXT("DegSinCos"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("DecimatedDegSinCosName", "SinCos (degrees) (Audio, Decimated)"); }
+		};
+	}
+
+	/** TDecimatedSinNodeOperator
+	 *
+	 *  Audio-rate sine, or sine and cosine, evaluated only every Decimation frames with the frames in between
+	 *  interpolated. For modulation signals, where the phase moves a small fraction of a turn per stride.
+	 */
+	template <typename FamilyType>
+	class TDecimatedSinNodeOperator : public TExecutableOperator<TDecimatedSinNodeOperator<FamilyType>>
+	{
+	public:
+		struct FDecimationSettings
+		{
+			ExtensionsMath::ETrigPrecision Precision = ExtensionsMath::ETrigPrecision::Balanced;
+			int32 Decimation = MetasoundDecimatedSinNodePrivate::DefaultDecimation;
+			ExtensionsMath::EDecimationInterpolation Interpolation = ExtensionsMath::EDecimationInterpolation::Cubic;
+		};
+
+		static const FVertexInterface& GetDefaultInterface()
+		{
+			using namespace DecimatedSinVertexNames;
+
+			auto CreateDefaultInterface = []() -> FVertexInterface
+			{
+				FInputVertexInterface InputInterface(
+					TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputValue)),
+					TInputConstructorVertex<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputPrecision), static_cast<int32>(ExtensionsMath::ETrigPrecision::Balanced)),
+					TInputConstructorVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDecimation), MetasoundDecimatedSinNodePrivate::DefaultDecimation),
+					TInputConstructorVertex<FEnumDecimationInterpolation>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInterpolation), static_cast<int32>(ExtensionsMath::EDecimationInterpolation::Cubic))
+				);
+
+				FOutputVertexInterface OutputInterface;
+				if constexpr (FamilyType::bSinCos)
+				{
+					OutputInterface.Add(TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSin)));
+					OutputInterface.Add(TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputCos)));
+				}
+				else
+				{
+					OutputInterface.Add(TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputValue)));
+				}
+
+				return FVertexInterface(InputInterface, OutputInterface);
+			};
+
+			static const FVertexInterface DefaultInterface = CreateDefaultInterface();
+			return DefaultInterface;
+		}
+
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+			{
+				const FName OperatorName = *FString::Printf(TEXT("%sDecimated"), *FamilyType::GetFamilyName().ToString());
+				const FText NodeDescription = FamilyType::bSinCos
+					? METASOUND_LOCTEXT("DecimatedSinCosDesc", "Returns the sine and cosine of the input, evaluated every Decimation frames and interpolated in between.")
+					: METASOUND_LOCTEXT("DecimatedSinDesc", "Returns the sine of the input, evaluated every Decimation frames and interpolated in between.");
+
+				return UnaryMathNodePrivate::CreateNodeClassMetadata(FamilyType::GetFamilyName(), OperatorName, FamilyType::MajorVersion, FamilyType::MinorVersion, GetMetasoundDataTypeName<FAudioBuffer>(), FamilyType::GetDisplayName(), NodeDescription, GetDefaultInterface());
+			};
+
+			static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+			return Metadata;
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutResults)
+		{
+			METASOUND_EXTENSIONS_TRACE_CREATE_SCOPE(GetNodeInfo().ClassName);
+
+			using namespace DecimatedSinVertexNames;
+
+			const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+			FAudioBufferReadRef Input = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputValue), InParams.OperatorSettings);
+			const bool bIsConstantInput = IsConstantInput(InputData, METASOUND_GET_PARAM_NAME(InputValue));
+
+			FDecimationSettings Settings;
+			Settings.Precision = InputData.GetOrCreateDefaultValue<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME(InputPrecision), InParams.OperatorSettings).Get();
+			Settings.Decimation = FMath::Clamp(InputData.GetOrCreateDefaultValue<int32>(METASOUND_GET_PARAM_NAME(InputDecimation), InParams.OperatorSettings), 1, ExtensionsMath::MaxDecimationStride);
+			Settings.Interpolation = InputData.GetOrCreateDefaultValue<FEnumDecimationInterpolation>(METASOUND_GET_PARAM_NAME(InputInterpolation), InParams.OperatorSettings).Get();
+
+			return MakeUnique<TDecimatedSinNodeOperator<FamilyType>>(InParams.OperatorSettings, Input, bIsConstantInput, Settings);
+		}
+
+
+		TDecimatedSinNodeOperator(const FOperatorSettings& InSettings,
+		                          const FAudioBufferReadRef& InInput,
+		                          bool bInIsConstantInput,
+		                          const FDecimationSettings& InDecimationSettings)
+			: Input(InInput)
+			  , OutputSin(FAudioBufferWriteRef::CreateNew(InSettings))
+			  , NodeClassStats(ExtensionsNodeStats::FindOrAddNodeClassStats(GetNodeInfo().ClassName))
+			  , Settings(InDecimationSettings)
+			  , bIsConstantInput(bInIsConstantInput)
+		{
+			if constexpr (FamilyType::bSinCos)
+			{
+				OutputCos.Emplace(FAudioBufferWriteRef::CreateNew(InSettings));
+			}
+
+			NodeClassStats.AddInstance();
+
+			Evaluate();
+		}
+
+		virtual ~TDecimatedSinNodeOperator()
+		{
+			NodeClassStats.RemoveInstance();
+		}
+
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace DecimatedSinVertexNames;
+			bIsConstantInput = BindConstantReadVertex(InOutVertexData, METASOUND_GET_PARAM_NAME(InputValue), Input, bIsConstantInput);
+			InOutVertexData.SetValue(METASOUND_GET_PARAM_NAME(InputPrecision), FEnumTrigPrecision(Settings.Precision));
+			InOutVertexData.SetValue(METASOUND_GET_PARAM_NAME(InputDecimation), Settings.Decimation);
+			InOutVertexData.SetValue(METASOUND_GET_PARAM_NAME(InputInterpolation), FEnumDecimationInterpolation(Settings.Interpolation));
+
+			// The input may now be a different buffer, so the outputs are solved again from it.
+			Evaluate();
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace DecimatedSinVertexNames;
+
+			if constexpr (FamilyType::bSinCos)
+			{
+				InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputSin), OutputSin);
+				InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputCos), OutputCos.GetValue());
+			}
+			else
+			{
+				InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputValue), OutputSin);
+			}
+		}
+
+		virtual IOperator::FExecuteFunction GetExecuteFunction() override
+		{
+			// A constant input is solved on construction and Reset, so the operator can drop out of the render loop entirely.
+			if (bIsConstantInput)
+			{
+				return nullptr;
+			}
+
+			return TExecutableOperator<TDecimatedSinNodeOperator<FamilyType>>::GetExecuteFunction();
+		}
+
+		void Evaluate()
+		{
+			FAudioBuffer& OutSin = *OutputSin;
+
+			TArrayView<const float> InView(Input->GetData(), OutSin.Num());
+			TArrayView<float> OutSinView(OutSin.GetData(), OutSin.Num());
+
+			if constexpr (FamilyType::bSinCos)
+			{
+				FAudioBuffer& OutCos = *OutputCos.GetValue();
+				TArrayView<float> OutCosView(OutCos.GetData(), OutCos.Num());
+
+				ExtensionsMath::ArraySinCosDecimated(InView, OutSinView, OutCosView, FamilyType::Scale, Settings.Decimation, Settings.Interpolation, Settings.Precision);
+			}
+			else
+			{
+				ExtensionsMath::ArraySinDecimated(InView, OutSinView, FamilyType::Scale, Settings.Decimation, Settings.Interpolation, Settings.Precision);
+			}
+		}
+
+		void Execute()
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ExecuteTraceSpecId);
+			ExtensionsNodeStats::FScopedExecuteTimer ExecuteTimer(NodeClassStats);
+
+			Evaluate();
+			NodeClassStats.RecordEvaluation();
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ResetTraceSpecId);
+
+			Evaluate();
+		}
+
+	private:
+		FAudioBufferReadRef Input;
+		FAudioBufferWriteRef OutputSin;
+
+		// Only set for the sine and cosine families.
+		TOptional<FAudioBufferWriteRef> OutputCos;
+
+		ExtensionsNodeStats::FNodeClassStats& NodeClassStats;
+
+		FDecimationSettings Settings;
+
+		bool bIsConstantInput = false;
+	};
+
+	/** TDecimatedSinNode
+	 *
+	 *  Audio-rate sine or sine and cosine, evaluated every Decimation frames and interpolated in between.
+	 */
+	template <typename FamilyType>
+	using TDecimatedSinNode = TNodeFacade<TDecimatedSinNodeOperator<FamilyType>>;
+
+	using FSinNodeDecimated = TDecimatedSinNode<MetasoundDecimatedSinNodePrivate::FDecimatedSin>;
+	METASOUND_REGISTER_NODE(FSinNodeDecimated)
+
+	using FDegSinNodeDecimated = TDecimatedSinNode<MetasoundDecimatedSinNodePrivate::FDecimatedDegSin>;
+	METASOUND_REGISTER_NODE(FDegSinNodeDecimated)
+
+	using FSinCosNodeDecimated = TDecimatedSinNode<MetasoundDecimatedSinNodePrivate::FDecimatedSinCos>;
+	METASOUND_REGISTER_NODE(FSinCosNodeDecimated)
+
+	using FDegSinCosNodeDecimated = TDecimatedSinNode<MetasoundDecimatedSinNodePrivate::FDecimatedDegSinCos>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeDecimated)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,27 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundDegSinCosNodes.h"
+
+#include "MetasoundNodeRegistrationMacro.h"
+
+namespace Metasound
+{
+	/** TDegSinCosNode
+	 *
+	 *  Returns the sine and cosine of the input angle in degrees from a single shared range reduction.
+	 */
+	template <typename ValueType>
+	using TDegSinCosNode = TSinCosNode<MetasoundDegSinCosNodePrivate::FDegSinCosPolicy, ValueType>;
+
+	using FDegSinCosNodeInt32 = TDegSinCosNode<int32>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeInt32)
+
+	using FDegSinCosNodeFloat = TDegSinCosNode<float>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeFloat)
+
+	using FDegSinCosNodeTime = TDegSinCosNode<FTime>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeTime)
+
+	using FDegSinCosNodeAudioBuffer = TDegSinCosNode<FAudioBuffer>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeAudioBuffer)
+}
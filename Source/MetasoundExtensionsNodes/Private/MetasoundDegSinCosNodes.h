@@ -0,0 +1,65 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsSinCosNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_DegSinCosNode"
+
+namespace Metasound
+{
+	namespace MetasoundDegSinCosNodePrivate
+	{
+		struct FDegSinCosPolicy
+		{
+			static constexpr const TCHAR* Name = TEXT("DegSinCos");
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 1;
+			static constexpr ExtensionsMath::ETrigPrecision DefaultPrecision = ExtensionsMath::ETrigPrecision::Exact;
+			static constexpr ExtensionsMath::ETrigPrecision DefaultBlockPrecision = ExtensionsMath::ETrigPrecision::Balanced;
+
+			static FText GetDisplayName(const FText& InDataTypeDisplayText)
+			{
+				return METASOUND_LOCTEXT_FORMAT("DegSinCosDisplayNamePattern", "SinCos (degrees) ({0})", InDataTypeDisplayText);
+			}
+
+			static FText GetDescription()
+			{
+				return METASOUND_LOCTEXT("DegSinCosDesc", "Returns the sine and cosine of the input angle in degrees from a single shared range reduction.");
+			}
+
+			static FText GetInputDescription()
+			{
+				return METASOUND_LOCTEXT("InputValueTooltip", "Input value in degrees.");
+			}
+
+			static void EvaluateInt32(const int32 In, float& OutSin, float& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				// Whole degrees are exact in the integer table, so every precision mode shares it.
+				ExtensionsMath::SinCosIntegerDegrees(In, OutSin, OutCos);
+			}
+
+			static void EvaluateFloat(const float In, float& OutSin, float& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				double Sin = 0.0;
+				double Cos = 0.0;
+				ExtensionsMath::SinCosDegrees(In, Sin, Cos, InKernel);
+
+				OutSin = static_cast<float>(Sin);
+				OutCos = static_cast<float>(Cos);
+			}
+
+			static void EvaluateDouble(const double In, double& OutSin, double& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				ExtensionsMath::SinCosDegrees(In, OutSin, OutCos, InKernel);
+			}
+
+			static void EvaluateBlock(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				ExtensionsMath::ArraySinCosDegrees(InValues, OutSinValues, OutCosValues, InKernel);
+			}
+		};
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
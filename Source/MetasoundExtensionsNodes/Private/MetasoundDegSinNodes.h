@@ -0,0 +1,62 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsUnaryMathNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_DegSinNode"
+
+namespace Metasound
+{
+	namespace MetasoundDegSinNodePrivate
+	{
+		struct FDegSinPolicy
+		{
+			static constexpr const TCHAR* Name = TEXT("DegSin");
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 1;
+			static constexpr bool bHasPrecision = true;
+			static constexpr ExtensionsMath::ETrigPrecision DefaultPrecision = ExtensionsMath::ETrigPrecision::Exact;
+			static constexpr ExtensionsMath::ETrigPrecision DefaultBlockPrecision = ExtensionsMath::ETrigPrecision::Balanced;
+
+			static FText GetDisplayName(const FText& InDataTypeDisplayText)
+			{
+				return METASOUND_LOCTEXT_FORMAT("DegSinDisplayNamePattern", "Sin (degrees) ({0})", InDataTypeDisplayText);
+			}
+
+			static FText GetDescription()
+			{
+				return METASOUND_LOCTEXT("DegSinDesc", "Returns the sine of the input value.");
+			}
+
+			static FText GetOutputDescription()
+			{
+				return METASOUND_LOCTEXT("OutputValueTooltip", "The solved sine of the input.");
+			}
+
+			static int32 EvaluateInt32(const int32 In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				// Truncated, the sine of whole degrees is 1 at 90, -1 at 270 and 0 at every other angle. The integer table
+				// gets the peaks and the +0 crossings exactly, so every precision mode shares it.
+				return static_cast<int32>(ExtensionsMath::SinIntegerDegrees(In));
+			}
+
+			static float EvaluateFloat(const float In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return static_cast<float>(ExtensionsMath::SinDegrees(In, InKernel));
+			}
+
+			static double EvaluateDouble(const double In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return ExtensionsMath::SinDegrees(In, InKernel);
+			}
+
+			static void EvaluateBlock(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				ExtensionsMath::ArraySinDegrees(InValues, OutValues, InKernel);
+			}
+		};
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,58 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsUnaryMathNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_DegreesToRadiansNode"
+
+namespace Metasound
+{
+	namespace MetasoundDegreesToRadiansNodePrivate
+	{
+		struct FDegreesToRadiansPolicy
+		{
+			static constexpr const TCHAR* Name = TEXT("DegreesToRadians");
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = false;
+
+			static FText GetDisplayName(const FText& InDataTypeDisplayText)
+			{
+				return METASOUND_LOCTEXT_FORMAT("DegreesToRadiansDisplayNamePattern", "Degrees To Radians ({0})", InDataTypeDisplayText);
+			}
+
+			static FText GetDescription()
+			{
+				return METASOUND_LOCTEXT("DegreesToRadiansDesc", "Returns the radian value corresponding to the input degree value.");
+			}
+
+			static FText GetOutputDescription()
+			{
+				return METASOUND_LOCTEXT("OutputValueTooltip", "The output value in radians.");
+			}
+
+			static int32 EvaluateInt32(const int32 In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return static_cast<int32>(FMath::DegreesToRadians(static_cast<float>(In)));
+			}
+
+			static float EvaluateFloat(const float In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return FMath::DegreesToRadians(In);
+			}
+
+			static double EvaluateDouble(const double In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return FMath::DegreesToRadians(In);
+			}
+
+			static void EvaluateBlock(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				ExtensionsMath::ArrayScale(InValues, OutValues, UE_PI / 180.0f);
+			}
+		};
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
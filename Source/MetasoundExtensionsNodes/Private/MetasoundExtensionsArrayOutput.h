@@ -0,0 +1,40 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+namespace Metasound
+{
+	/** Resizes an array output to InNum elements without ever releasing its allocation, so once an output has grown to
+	 *  the largest input it has seen, later blocks write into it without allocating. */
+	template <typename ElementType>
+	void ResizeArrayOutput(TArray<ElementType>& OutValues, const int32 InNum)
+	{
+		if (OutValues.Num() != InNum)
+		{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 4
+			OutValues.SetNum(InNum, false);
+#else
+			OutValues.SetNum(InNum, EAllowShrinking::No);
+#endif
+		}
+	}
+
+	/** Writes InFunction(InValues[i]) to every element of the output, after resizing it to match the input. For element
+	 *  types without a block kernel. */
+	template <typename InElementType, typename OutElementType, typename FunctionType>
+	void TransformArray(const TArray<InElementType>& InValues, TArray<OutElementType>& OutValues, FunctionType&& InFunction)
+	{
+		ResizeArrayOutput(OutValues, InValues.Num());
+
+		const int32 Num = InValues.Num();
+		const InElementType* InData = InValues.GetData();
+		OutElementType* OutData = OutValues.GetData();
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			OutData[Index] = InFunction(InData[Index]);
+		}
+	}
+}
@@ -0,0 +1,104 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundDataReference.h"
+#include "MetasoundVertexData.h"
+
+namespace Metasound
+{
+	/** TInputCache
+	 *
+	 *  Remembers the last control-rate input an operator evaluated, so Execute can skip both the
+	 *  evaluation and the output write while the input holds its value.
+	 */
+	template <typename ValueType>
+	class TInputCache
+	{
+	public:
+		/** Stores InValue and returns true if it differs from the previously stored value. */
+		bool Update(const ValueType& InValue)
+		{
+			if (bIsSet && LastValue == InValue)
+			{
+				return false;
+			}
+
+			LastValue = InValue;
+			bIsSet = true;
+			return true;
+		}
+
+		void Reset()
+		{
+			bIsSet = false;
+		}
+
+	private:
+		ValueType LastValue{};
+		bool bIsSet = false;
+	};
+
+	/** Audio buffers change every block, so comparing them would cost as much as evaluating them. */
+	template <>
+	class TInputCache<FAudioBuffer>
+	{
+	public:
+		bool Update(const FAudioBuffer& InValue)
+		{
+			return true;
+		}
+
+		void Reset()
+		{
+		}
+	};
+
+	/** Array inputs are compared element by element. The copy reuses the cached array's allocation, so an input that
+	 *  keeps its length never allocates here. */
+	template <typename ElementType>
+	class TInputCache<TArray<ElementType>>
+	{
+	public:
+		bool Update(const TArray<ElementType>& InValue)
+		{
+			if (bIsSet && LastValue == InValue)
+			{
+				return false;
+			}
+
+			LastValue.Reset();
+			LastValue.Append(InValue);
+			bIsSet = true;
+			return true;
+		}
+
+		void Reset()
+		{
+			bIsSet = false;
+		}
+
+	private:
+		TArray<ElementType> LastValue;
+		bool bIsSet = false;
+	};
+
+	/** Returns true if the input vertex is unconnected or bound to a literal, so its value can never change after the operator is built. */
+	inline bool IsConstantInput(const FInputVertexInterfaceData& InInputData, const FVertexName& InVertexName)
+	{
+		const FAnyDataReference* DataReference = InInputData.FindDataReference(InVertexName);
+		return (nullptr == DataReference) || (EDataReferenceAccessType::Value == DataReference->GetAccessType());
+	}
+
+	/** Binds InOutReference to the input vertex like BindReadVertex, and returns whether the input is constant afterwards.
+	 *  A live or dynamic graph that rebinds the node supplies a new reference, whose constness replaces bInWasConstant;
+	 *  a vertex without one keeps the operator's own reference, and so its previous constness. */
+	template <typename DataType>
+	bool BindConstantReadVertex(FInputVertexInterfaceData& InOutVertexData, const FVertexName& InVertexName, TDataReadReference<DataType>& InOutReference, bool bInWasConstant)
+	{
+		const bool bIsConstant = (nullptr != InOutVertexData.FindDataReference(InVertexName)) ? IsConstantInput(InOutVertexData, InVertexName) : bInWasConstant;
+		InOutVertexData.BindReadVertex(InVertexName, InOutReference);
+		return bIsConstant;
+	}
+}
@@ -0,0 +1,254 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsNodeStats.h"
+
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+#if METASOUND_EXTENSIONS_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(MetasoundExtensionsChannel)
+#endif
+
+#if CSV_PROFILER && METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+CSV_DEFINE_CATEGORY(MetasoundExtensions, false);
+#endif
+
+namespace Metasound
+{
+	namespace ExtensionsNodeStats
+	{
+		namespace NodeStatsPrivate
+		{
+			/** Classes are pushed onto an intrusive list and never removed while the module is loaded, so readers can
+			 *  walk it from any thread without a lock. */
+			struct FRegistry
+			{
+				std::atomic<FNodeClassStats*> Head{nullptr};
+
+				~FRegistry()
+				{
+					FNodeClassStats* Stats = Head.exchange(nullptr);
+					while (nullptr != Stats)
+					{
+						FNodeClassStats* Next = Stats->Next;
+						delete Stats;
+						Stats = Next;
+					}
+				}
+			};
+
+			FRegistry& GetRegistry()
+			{
+				static FRegistry Registry;
+				return Registry;
+			}
+
+			/** Searches the entries from InFirst up to, but not including, InLast. */
+			FNodeClassStats* FindNodeClassStats(FNodeClassStats* InFirst, const FNodeClassStats* InLast, FName InName)
+			{
+				for (FNodeClassStats* Stats = InFirst; Stats != InLast; Stats = Stats->Next)
+				{
+					if (Stats->NodeClassName == InName)
+					{
+						return Stats;
+					}
+				}
+
+				return nullptr;
+			}
+
+			/** Returns every registered class, sorted by name for stable output. */
+			TArray<FNodeClassStats*> GetSortedNodeClassStats()
+			{
+				TArray<FNodeClassStats*> Result;
+				for (FNodeClassStats* Stats = GetRegistry().Head.load(std::memory_order_acquire); nullptr != Stats; Stats = Stats->Next)
+				{
+					Result.Add(Stats);
+				}
+
+				Result.Sort([](const FNodeClassStats& A, const FNodeClassStats& B) { return A.NodeClassName.LexicalLess(B.NodeClassName); });
+				return Result;
+			}
+
+			void DumpNodeClassStats(FOutputDevice& Ar)
+			{
+#if METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+				Ar.Logf(TEXT("MetasoundExtensions node evaluation stats:"));
+				for (const FNodeClassStats* Stats : GetSortedNodeClassStats())
+				{
+					const uint64 NumEvaluations = Stats->NumEvaluations.load(std::memory_order_relaxed);
+					const uint64 NumSkipped = Stats->NumSkippedEvaluations.load(std::memory_order_relaxed);
+					const uint64 NumTotal = NumEvaluations + NumSkipped;
+					const double SkippedPercent = NumTotal > 0 ? 100.0 * static_cast<double>(NumSkipped) / static_cast<double>(NumTotal) : 0.0;
+
+					const int32 NumInstances = Stats->NumLiveInstances.load(std::memory_order_relaxed);
+					const uint64 NumExecutions = Stats->NumExecutions.load(std::memory_order_relaxed);
+					const double ExecuteMs = FPlatformTime::ToMilliseconds64(Stats->NumExecuteCycles.load(std::memory_order_relaxed));
+					const double NsPerExecute = NumExecutions > 0 ? 1.0e6 * ExecuteMs / static_cast<double>(NumExecutions) : 0.0;
+
+					Ar.Logf(TEXT("  %-48s instances: %6d  executions: %12llu  execute: %10.3f ms (%8.1f ns each)  evaluated: %12llu  skipped: %12llu  (%.1f%% skipped)"),
+						*Stats->NodeClassName.ToString(), NumInstances, NumExecutions, ExecuteMs, NsPerExecute, NumEvaluations, NumSkipped, SkippedPercent);
+				}
+#else
+				Ar.Logf(TEXT("MetasoundExtensions node stats are compiled out of this build."));
+#endif
+			}
+
+			void ResetNodeClassStats()
+			{
+				// Live instance counts describe current state rather than history, so they are kept.
+				for (FNodeClassStats* Stats = GetRegistry().Head.load(std::memory_order_acquire); nullptr != Stats; Stats = Stats->Next)
+				{
+#if METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+					Stats->NumEvaluations.store(0, std::memory_order_relaxed);
+					Stats->NumSkippedEvaluations.store(0, std::memory_order_relaxed);
+					Stats->NumExecutions.store(0, std::memory_order_relaxed);
+					Stats->NumExecuteCycles.store(0, std::memory_order_relaxed);
+#endif
+				}
+			}
+
+			static FAutoConsoleCommandWithOutputDevice DumpNodeStatsCommand(
+				TEXT("au.MetasoundExtensions.DumpNodeStats"),
+				TEXT("Prints live instances, executions, execute time and skipped evaluations for each MetasoundExtensions node class."),
+				FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&DumpNodeClassStats));
+
+			static FAutoConsoleCommand ResetNodeStatsCommand(
+				TEXT("au.MetasoundExtensions.ResetNodeStats"),
+				TEXT("Clears the MetasoundExtensions node execution and evaluation counters."),
+				FConsoleCommandDelegate::CreateStatic(&ResetNodeClassStats));
+
+#if CSV_PROFILER && METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+			struct FCsvStatNames
+			{
+				FName Instances;
+				FName Executions;
+				FName ExecuteMs;
+			};
+
+			FTSTicker::FDelegateHandle CsvTickerHandle;
+
+			/** Records each class's instances, and its executions and execute time since the previous frame. */
+			bool RecordCsvStats(float InDeltaTime)
+			{
+				// Disabled categories are filtered by RecordCustomStat, so only whole captures are worth skipping here.
+				if (!FCsvProfiler::Get()->IsCapturing())
+				{
+					return true;
+				}
+
+				static TMap<FName, FCsvStatNames> StatNames;
+
+				for (FNodeClassStats* Stats = GetRegistry().Head.load(std::memory_order_acquire); nullptr != Stats; Stats = Stats->Next)
+				{
+					FCsvStatNames* Names = StatNames.Find(Stats->NodeClassName);
+					if (nullptr == Names)
+					{
+						const FString ClassName = Stats->NodeClassName.ToString();
+						Names = &StatNames.Add(Stats->NodeClassName, FCsvStatNames{
+							FName(ClassName + TEXT("/Instances")),
+							FName(ClassName + TEXT("/Executions")),
+							FName(ClassName + TEXT("/ExecuteMs"))});
+					}
+
+					const uint64 NumExecutions = Stats->NumExecutions.load(std::memory_order_relaxed);
+					const uint64 NumExecuteCycles = Stats->NumExecuteCycles.load(std::memory_order_relaxed);
+
+					// Counters may have been reset since the last frame.
+					const uint64 FrameExecutions = NumExecutions >= Stats->LastCsvExecutions ? NumExecutions - Stats->LastCsvExecutions : NumExecutions;
+					const uint64 FrameCycles = NumExecuteCycles >= Stats->LastCsvExecuteCycles ? NumExecuteCycles - Stats->LastCsvExecuteCycles : NumExecuteCycles;
+					Stats->LastCsvExecutions = NumExecutions;
+					Stats->LastCsvExecuteCycles = NumExecuteCycles;
+
+					const int32 CategoryIndex = CSV_CATEGORY_INDEX(MetasoundExtensions);
+					FCsvProfiler::RecordCustomStat(Names->Instances, CategoryIndex, Stats->NumLiveInstances.load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+					FCsvProfiler::RecordCustomStat(Names->Executions, CategoryIndex, static_cast<int32>(FMath::Min<uint64>(FrameExecutions, MAX_int32)), ECsvCustomStatOp::Set);
+					FCsvProfiler::RecordCustomStat(Names->ExecuteMs, CategoryIndex, FPlatformTime::ToMilliseconds64(FrameCycles), ECsvCustomStatOp::Set);
+				}
+
+				return true;
+			}
+#endif
+
+#if METASOUND_EXTENSIONS_TRACE_ENABLED
+			int32 TraceEnabledCVar = 0;
+
+			void OnTraceEnabledChanged(IConsoleVariable* InVariable)
+			{
+				UE::Trace::ToggleChannel(TEXT("MetasoundExtensions"), InVariable->GetBool());
+			}
+
+			static FAutoConsoleVariableRef CVarTraceEnabled(
+				TEXT("au.MetasoundExtensions.Trace"),
+				TraceEnabledCVar,
+				TEXT("Emits Unreal Insights timing events and counters for every MetasoundExtensions node class (the Cpu channel must be enabled too).\n")
+				TEXT("0: Off (default, unless started with -trace=MetasoundExtensions), 1: On"),
+				FConsoleVariableDelegate::CreateStatic(&OnTraceEnabledChanged),
+				ECVF_Default);
+
+			void RegisterTraceEvents(FNodeClassStats& InStats)
+			{
+				const FString ClassName = InStats.NodeClassName.ToString();
+
+				InStats.CreateTraceSpecId = FCpuProfilerTrace::OutputEventType(*FString::Printf(TEXT("%s CreateOperator"), *ClassName));
+				InStats.ExecuteTraceSpecId = FCpuProfilerTrace::OutputEventType(*FString::Printf(TEXT("%s Execute"), *ClassName));
+				InStats.ResetTraceSpecId = FCpuProfilerTrace::OutputEventType(*FString::Printf(TEXT("%s Reset"), *ClassName));
+
+				InStats.EvaluationsCounterId = FCountersTrace::OutputInitCounter(*FString::Printf(TEXT("MetasoundExtensions/%s/Evaluations"), *ClassName), TraceCounterType_Int, TraceCounterDisplayHint_None);
+				InStats.SkippedEvaluationsCounterId = FCountersTrace::OutputInitCounter(*FString::Printf(TEXT("MetasoundExtensions/%s/Skipped"), *ClassName), TraceCounterType_Int, TraceCounterDisplayHint_None);
+			}
+#endif
+		}
+
+		FNodeClassStats& FindOrAddNodeClassStats(const FNodeClassName& InClassName)
+		{
+			using namespace NodeStatsPrivate;
+
+			FRegistry& Registry = GetRegistry();
+			const FName FullName = InClassName.GetFullName();
+
+			FNodeClassStats* Head = Registry.Head.load(std::memory_order_acquire);
+			if (FNodeClassStats* Existing = FindNodeClassStats(Head, nullptr, FullName))
+			{
+				return *Existing;
+			}
+
+			TUniquePtr<FNodeClassStats> Stats = MakeUnique<FNodeClassStats>();
+			Stats->NodeClassName = FullName;
+
+#if METASOUND_EXTENSIONS_TRACE_ENABLED
+			RegisterTraceEvents(*Stats);
+#endif
+
+			Stats->Next = Head;
+			while (!Registry.Head.compare_exchange_weak(Stats->Next, Stats.Get(), std::memory_order_release, std::memory_order_acquire))
+			{
+				// Another thread published entries in the meantime, and one of them may be this class.
+				if (FNodeClassStats* Existing = FindNodeClassStats(Stats->Next, Head, FullName))
+				{
+					return *Existing;
+				}
+
+				Head = Stats->Next;
+			}
+
+			return *Stats.Release();
+		}
+
+		void StartupNodeClassStats()
+		{
+#if CSV_PROFILER && METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+			NodeStatsPrivate::CsvTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&NodeStatsPrivate::RecordCsvStats));
+#endif
+		}
+
+		void ShutdownNodeClassStats()
+		{
+#if CSV_PROFILER && METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+			FTSTicker::GetCoreTicker().RemoveTicker(NodeStatsPrivate::CsvTickerHandle);
+			NodeStatsPrivate::CsvTickerHandle.Reset();
+#endif
+		}
+	}
+}
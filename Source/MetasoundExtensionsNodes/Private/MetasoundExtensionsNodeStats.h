@@ -0,0 +1,141 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/PlatformTime.h"
+#include "MetasoundExtensionsTrace.h"
+#include "MetasoundNodeInterface.h"
+
+#include <atomic>
+
+/** Live instance counts, Execute timing and evaluation counts per node class. Cheap enough for test builds, compiled
+ *  out of shipping. */
+#define METASOUND_EXTENSIONS_NODE_TIMING_ENABLED (!UE_BUILD_SHIPPING)
+
+namespace Metasound
+{
+	namespace ExtensionsNodeStats
+	{
+		/** FNodeClassStats
+		 *
+		 *  Counters shared by every operator instance of one node class. Updates are relaxed atomics so
+		 *  they are safe to bump from any render thread.
+		 */
+		struct FNodeClassStats
+		{
+			FName NodeClassName;
+
+#if METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+			std::atomic<uint64> NumEvaluations{0};
+			std::atomic<uint64> NumSkippedEvaluations{0};
+			std::atomic<int32> NumLiveInstances{0};
+			std::atomic<uint64> NumExecutions{0};
+			std::atomic<uint64> NumExecuteCycles{0};
+
+			// Totals already written to the CSV profile, so each frame records its own share. Game thread only.
+			uint64 LastCsvExecutions = 0;
+			uint64 LastCsvExecuteCycles = 0;
+#endif
+
+			// Next class in the registry. Written once before the entry is published.
+			FNodeClassStats* Next = nullptr;
+
+#if METASOUND_EXTENSIONS_TRACE_ENABLED
+			// Timing events named "<node class> Execute" etc., and Insights counters mirroring the totals above.
+			uint32 CreateTraceSpecId = 0;
+			uint32 ExecuteTraceSpecId = 0;
+			uint32 ResetTraceSpecId = 0;
+			uint16 EvaluationsCounterId = 0;
+			uint16 SkippedEvaluationsCounterId = 0;
+#endif
+
+			void RecordEvaluation()
+			{
+#if METASOUND_EXTENSIONS_TRACE_ENABLED
+				TraceCounter(EvaluationsCounterId, NumEvaluations.fetch_add(1, std::memory_order_relaxed) + 1);
+#elif METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+				NumEvaluations.fetch_add(1, std::memory_order_relaxed);
+#endif
+			}
+
+			void RecordSkippedEvaluation()
+			{
+#if METASOUND_EXTENSIONS_TRACE_ENABLED
+				TraceCounter(SkippedEvaluationsCounterId, NumSkippedEvaluations.fetch_add(1, std::memory_order_relaxed) + 1);
+#elif METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+				NumSkippedEvaluations.fetch_add(1, std::memory_order_relaxed);
+#endif
+			}
+
+			void AddInstance()
+			{
+#if METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+				NumLiveInstances.fetch_add(1, std::memory_order_relaxed);
+#endif
+			}
+
+			void RemoveInstance()
+			{
+#if METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+				NumLiveInstances.fetch_sub(1, std::memory_order_relaxed);
+#endif
+			}
+
+#if METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+			void RecordExecute(uint64 InCycles)
+			{
+				NumExecutions.fetch_add(1, std::memory_order_relaxed);
+				NumExecuteCycles.fetch_add(InCycles, std::memory_order_relaxed);
+			}
+#endif
+
+#if METASOUND_EXTENSIONS_TRACE_ENABLED
+		private:
+			static void TraceCounter(uint16 InCounterId, uint64 InValue)
+			{
+				if (UE_TRACE_CHANNELEXPR_IS_ENABLED(MetasoundExtensionsChannel))
+				{
+					FCountersTrace::OutputSetValue(InCounterId, static_cast<int64>(InValue));
+				}
+			}
+#endif
+		};
+
+		/** FScopedExecuteTimer
+		 *
+		 *  Counts one Execute call and the cycles spent in the enclosing scope.
+		 */
+		class FScopedExecuteTimer
+		{
+		public:
+#if METASOUND_EXTENSIONS_NODE_TIMING_ENABLED
+			explicit FScopedExecuteTimer(FNodeClassStats& InStats)
+				: Stats(InStats)
+				, StartCycles(FPlatformTime::Cycles64())
+			{
+			}
+
+			~FScopedExecuteTimer()
+			{
+				Stats.RecordExecute(FPlatformTime::Cycles64() - StartCycles);
+			}
+
+		private:
+			FNodeClassStats& Stats;
+			uint64 StartCycles;
+#else
+			explicit FScopedExecuteTimer(FNodeClassStats&)
+			{
+			}
+#endif
+		};
+
+		/** Returns the stats for the given node class, creating them on first use. Lookups never take a lock, and
+		 *  the reference stays valid for the lifetime of the module. */
+		FNodeClassStats& FindOrAddNodeClassStats(const FNodeClassName& InClassName);
+
+		/** Starts and stops recording the stats into the MetasoundExtensions CSV profiler category once per frame. */
+		void StartupNodeClassStats();
+		void ShutdownNodeClassStats();
+	}
+}
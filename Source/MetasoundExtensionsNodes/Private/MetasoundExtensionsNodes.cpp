@@ -1,6 +1,10 @@
 ﻿// Copyright Hitbox Games, LLC. All Rights Reserved.
 
 #include "MetasoundExtensionsNodes.h"
+#include "HAL/IConsoleManager.h"
+#include "MetasoundExtensionsMath.h"
+#include "MetasoundExtensionsNodeStats.h"
+#include "MetasoundExtensionsSineTable.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 8
@@ -11,10 +15,65 @@
 
 #define LOCTEXT_NAMESPACE "FMetasoundExtensionsNodesModule"
 
+DEFINE_LOG_CATEGORY_STATIC(LogMetasoundExtensions, Log, All);
+
 namespace Metasound
 {
+	namespace MetasoundExtensionsNodesPrivate
+	{
+		static int32 SineTableSizeCVar = ExtensionsMath::DefaultSineTableSize;
+		static FAutoConsoleVariableRef CVarSineTableSize(
+			TEXT("au.MetasoundExtensions.SineTableSize"),
+			SineTableSizeCVar,
+			TEXT("Entries per period in the shared sine table used by the Table precision modes. Rounded up to a power of two.\n")
+			TEXT("Read once when the module starts up."),
+			ECVF_ReadOnly);
+
+		static int32 VectorTierCVar = -1;
+
+		void ApplyVectorTier()
+		{
+			const ExtensionsMath::EVectorTier SupportedTier = ExtensionsMath::GetSupportedVectorTier();
+			const ExtensionsMath::EVectorTier RequestedTier = (VectorTierCVar < 0) ? SupportedTier : static_cast<ExtensionsMath::EVectorTier>(FMath::Min<int32>(VectorTierCVar, static_cast<int32>(ExtensionsMath::EVectorTier::Avx512)));
+			const ExtensionsMath::EVectorTier Tier = ExtensionsMath::SetVectorTier(RequestedTier);
+
+			UE_CLOG(Tier != RequestedTier, LogMetasoundExtensions, Warning, TEXT("Vector tier %s is not supported here, using %s."), ExtensionsMath::LexToString(RequestedTier), ExtensionsMath::LexToString(Tier));
+			UE_LOG(LogMetasoundExtensions, Log, TEXT("Block kernels use the %s vector tier (supported: %s)."), ExtensionsMath::LexToString(Tier), ExtensionsMath::LexToString(SupportedTier));
+		}
+
+		static FAutoConsoleVariableRef CVarVectorTier(
+			TEXT("au.MetasoundExtensions.VectorTier"),
+			VectorTierCVar,
+			TEXT("Instruction set tier for the block kernels. Tiers the CPU cannot run fall back to the widest one it can.\n")
+			TEXT("-1: Widest supported (default), 0: Baseline (SSE/NEON), 1: AVX2, 2: AVX-512"),
+			FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*) { ApplyVectorTier(); }),
+			ECVF_Default);
+
+		static int32 UseIspcCVar = 0;
+
+		void ApplyUseIspc()
+		{
+			const bool bUseIspc = ExtensionsMath::SetUseIspcKernels(UseIspcCVar != 0);
+
+			UE_CLOG(UseIspcCVar != 0 && !bUseIspc, LogMetasoundExtensions, Warning, TEXT("ISPC block kernels were requested but this build does not contain them."));
+		}
+
+		static FAutoConsoleVariableRef CVarUseIspc(
+			TEXT("au.MetasoundExtensions.ISPC"),
+			UseIspcCVar,
+			TEXT("Runs the block kernels through their ISPC implementations instead of the vector tier's own code.\n")
+			TEXT("Only has an effect in builds compiled with ISPC. 0: Off (default), 1: On"),
+			FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*) { ApplyUseIspc(); }),
+			ECVF_Default);
+	}
+
 	void FMetasoundExtensionsNodesModule::StartupModule()
 	{
+		ExtensionsMath::InitializeSineTable(MetasoundExtensionsNodesPrivate::SineTableSizeCVar);
+		MetasoundExtensionsNodesPrivate::ApplyVectorTier();
+		MetasoundExtensionsNodesPrivate::ApplyUseIspc();
+		ExtensionsNodeStats::StartupNodeClassStats();
+
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 8
 		using namespace Frontend;
 		METASOUND_REGISTER_ITEMS_IN_MODULE
@@ -29,6 +88,9 @@ namespace Metasound
 		using namespace Frontend;
 		METASOUND_UNREGISTER_ITEMS_IN_MODULE
 #endif
+
+		ExtensionsNodeStats::ShutdownNodeClassStats();
+		ExtensionsMath::ReleaseSineTable();
 	}
 }
 
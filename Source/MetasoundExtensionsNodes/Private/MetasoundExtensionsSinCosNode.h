@@ -0,0 +1,286 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsUnaryMathNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundExtensionsNodes_SinCosNode"
+
+namespace Metasound
+{
+	namespace SinCosVertexNames
+	{
+		METASOUND_PARAM(InputValue, "Input", "Input angle.");
+		METASOUND_PARAM(OutputSin, "Sin", "The solved sine of the input.");
+		METASOUND_PARAM(OutputCos, "Cos", "The solved cosine of the input.");
+	}
+
+	namespace SinCosNodePrivate
+	{
+		/** TSinCosValue
+		 *
+		 *  Maps a data type onto the policy function that evaluates it, as TUnaryMathValue does for the unary nodes.
+		 */
+		template <typename ValueType>
+		struct TSinCosValue
+		{
+			bool bSupported = false;
+		};
+
+		template <>
+		struct TSinCosValue<int32>
+		{
+			static constexpr bool bIsBlock = false;
+
+			template <typename PolicyType>
+			static void Evaluate(const int32 In, int32& OutSin, int32& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				float Sin = 0.0f;
+				float Cos = 0.0f;
+				PolicyType::EvaluateInt32(In, Sin, Cos, InKernel);
+
+				OutSin = static_cast<int32>(Sin);
+				OutCos = static_cast<int32>(Cos);
+			}
+		};
+
+		template <>
+		struct TSinCosValue<float>
+		{
+			static constexpr bool bIsBlock = false;
+
+			template <typename PolicyType>
+			static void Evaluate(const float In, float& OutSin, float& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				PolicyType::EvaluateFloat(In, OutSin, OutCos, InKernel);
+			}
+		};
+
+		template <>
+		struct TSinCosValue<FTime>
+		{
+			static constexpr bool bIsBlock = false;
+
+			template <typename PolicyType>
+			static void Evaluate(const FTime& In, FTime& OutSin, FTime& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				double Sin = 0.0;
+				double Cos = 0.0;
+				PolicyType::EvaluateDouble(In.GetSeconds(), Sin, Cos, InKernel);
+
+				OutSin = FTime(Sin);
+				OutCos = FTime(Cos);
+			}
+		};
+
+		template <>
+		struct TSinCosValue<FAudioBuffer>
+		{
+			static constexpr bool bIsBlock = true;
+
+			template <typename PolicyType>
+			static void Evaluate(const FAudioBuffer& In, FAudioBuffer& OutSin, FAudioBuffer& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				TArrayView<float> OutSinView(OutSin.GetData(), OutSin.Num());
+				TArrayView<float> OutCosView(OutCos.GetData(), OutCos.Num());
+				TArrayView<const float> InView(In.GetData(), OutSin.Num());
+
+				PolicyType::EvaluateBlock(InView, OutSinView, OutCosView, InKernel);
+			}
+		};
+	}
+
+	/** TSinCosNodeOperator
+	 *
+	 *  Operator for the nodes that return the sine and cosine of one input. PolicyType supplies the angle unit:
+	 *
+	 *  Name                    Class namespace and operator name, e.g. TEXT("SinCos").
+	 *  MajorVersion            Class version numbers.
+	 *  MinorVersion
+	 *  DefaultPrecision        Default Precision for int32, float and FTime.
+	 *  DefaultBlockPrecision   Default Precision for audio buffers.
+	 *  GetDisplayName          Node display name, given the display name of the data type.
+	 *  GetDescription          Node description.
+	 *  GetInputDescription     Tooltip for the Input, naming its unit.
+	 *  EvaluateInt32           Scalar evaluation for int32, in float. The results are truncated to int32.
+	 *  EvaluateFloat           Scalar evaluation for float.
+	 *  EvaluateDouble          Scalar evaluation for FTime, in seconds.
+	 *  EvaluateBlock           Block evaluation for audio buffers. The views may alias.
+	 */
+	template <typename PolicyType, typename ValueType>
+	class TSinCosNodeOperator : public TExecutableOperator<TSinCosNodeOperator<PolicyType, ValueType>>
+	{
+		using FValueTraits = SinCosNodePrivate::TSinCosValue<ValueType>;
+
+	public:
+		static constexpr ExtensionsMath::ETrigPrecision GetDefaultPrecision()
+		{
+			return FValueTraits::bIsBlock ? PolicyType::DefaultBlockPrecision : PolicyType::DefaultPrecision;
+		}
+
+		static const FVertexInterface& GetDefaultInterface()
+		{
+			auto CreateDefaultInterface = []() -> FVertexInterface
+			{
+				using namespace SinCosVertexNames;
+				using namespace TrigPrecisionVertexNames;
+
+				return FVertexInterface(
+					FInputVertexInterface(
+						TInputDataVertex<ValueType>(METASOUND_GET_PARAM_NAME(InputValue), FDataVertexMetadata{PolicyType::GetInputDescription(), METASOUND_GET_PARAM_DISPLAYNAME(InputValue)}),
+						TInputConstructorVertex<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputPrecision), static_cast<int32>(GetDefaultPrecision()))
+					),
+					FOutputVertexInterface(
+						TOutputDataVertex<ValueType>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSin)),
+						TOutputDataVertex<ValueType>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputCos))
+					)
+				);
+			};
+
+			static const FVertexInterface DefaultInterface = CreateDefaultInterface();
+			return DefaultInterface;
+		}
+
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+			{
+				const FName DataTypeName = GetMetasoundDataTypeName<ValueType>();
+				const FText NodeDisplayName = PolicyType::GetDisplayName(GetMetasoundDataTypeDisplayText<ValueType>());
+
+				return UnaryMathNodePrivate::CreateNodeClassMetadata(PolicyType::Name, PolicyType::Name, PolicyType::MajorVersion, PolicyType::MinorVersion, DataTypeName, NodeDisplayName, PolicyType::GetDescription(), GetDefaultInterface());
+			};
+
+			static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+			return Metadata;
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutResults)
+		{
+			METASOUND_EXTENSIONS_TRACE_CREATE_SCOPE(GetNodeInfo().ClassName);
+
+			using namespace SinCosVertexNames;
+			using namespace TrigPrecisionVertexNames;
+
+			const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+			TDataReadReference<ValueType> Input = InputData.GetOrCreateDefaultDataReadReference<ValueType>(METASOUND_GET_PARAM_NAME(InputValue), InParams.OperatorSettings);
+			const bool bIsConstantInput = IsConstantInput(InputData, METASOUND_GET_PARAM_NAME(InputValue));
+			const FEnumTrigPrecision Precision = InputData.GetOrCreateDefaultValue<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME(InputPrecision), InParams.OperatorSettings);
+
+			return MakeUnique<TSinCosNodeOperator<PolicyType, ValueType>>(InParams.OperatorSettings, Input, bIsConstantInput, Precision.Get());
+		}
+
+
+		TSinCosNodeOperator(const FOperatorSettings& InSettings,
+		                    const TDataReadReference<ValueType>& InInput,
+		                    bool bInIsConstantInput,
+		                    ExtensionsMath::ETrigPrecision InPrecision)
+			: Input(InInput)
+			  , OutputSin(TDataWriteReferenceFactory<ValueType>::CreateAny(InSettings))
+			  , OutputCos(TDataWriteReferenceFactory<ValueType>::CreateAny(InSettings))
+			  , NodeClassStats(ExtensionsNodeStats::FindOrAddNodeClassStats(GetNodeInfo().ClassName))
+			  , Precision(InPrecision)
+			  , SinCosKernel(ExtensionsMath::GetSinCosKernel(InPrecision))
+			  , bIsConstantInput(bInIsConstantInput)
+		{
+			NodeClassStats.AddInstance();
+
+			Restart();
+		}
+
+		virtual ~TSinCosNodeOperator()
+		{
+			NodeClassStats.RemoveInstance();
+		}
+
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace SinCosVertexNames;
+			using namespace TrigPrecisionVertexNames;
+			bIsConstantInput = BindConstantReadVertex(InOutVertexData, METASOUND_GET_PARAM_NAME(InputValue), Input, bIsConstantInput);
+			InOutVertexData.SetValue(METASOUND_GET_PARAM_NAME(InputPrecision), FEnumTrigPrecision(Precision));
+
+			// The input may now be a different reference, so the outputs are solved again from its current value.
+			Restart();
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace SinCosVertexNames;
+			InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputSin), OutputSin);
+			InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputCos), OutputCos);
+		}
+
+		virtual IOperator::FExecuteFunction GetExecuteFunction() override
+		{
+			// A constant input is solved on construction and Reset, so the operator can drop out of the render loop entirely.
+			if (bIsConstantInput)
+			{
+				return nullptr;
+			}
+
+			return TExecutableOperator<TSinCosNodeOperator<PolicyType, ValueType>>::GetExecuteFunction();
+		}
+
+		void Evaluate()
+		{
+			FValueTraits::template Evaluate<PolicyType>(*Input, *OutputSin, *OutputCos, SinCosKernel);
+		}
+
+		void Execute()
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ExecuteTraceSpecId);
+			ExtensionsNodeStats::FScopedExecuteTimer ExecuteTimer(NodeClassStats);
+
+			// Control-rate inputs tend to hold their value for many blocks, in which case the outputs already hold the result.
+			if (InputCache.Update(*Input))
+			{
+				Evaluate();
+				NodeClassStats.RecordEvaluation();
+			}
+			else
+			{
+				NodeClassStats.RecordSkippedEvaluation();
+			}
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ResetTraceSpecId);
+
+			Restart();
+		}
+
+	private:
+		void Restart()
+		{
+			InputCache.Reset();
+			InputCache.Update(*Input);
+			Evaluate();
+		}
+
+		TDataReadReference<ValueType> Input;
+		TDataWriteReference<ValueType> OutputSin;
+		TDataWriteReference<ValueType> OutputCos;
+
+		TInputCache<ValueType> InputCache;
+		ExtensionsNodeStats::FNodeClassStats& NodeClassStats;
+
+		ExtensionsMath::ETrigPrecision Precision = ExtensionsMath::ETrigPrecision::Exact;
+		const ExtensionsMath::FSinCosKernel& SinCosKernel;
+
+		bool bIsConstantInput = false;
+	};
+
+	/** TSinCosNode
+	 *
+	 *  Node facade over TSinCosNodeOperator. Each angle unit's file defines its policy and registers one alias of this
+	 *  per data type.
+	 */
+	template <typename PolicyType, typename ValueType>
+	using TSinCosNode = TNodeFacade<TSinCosNodeOperator<PolicyType, ValueType>>;
+}
+
+#undef LOCTEXT_NAMESPACE
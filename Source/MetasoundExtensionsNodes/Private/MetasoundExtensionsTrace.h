@@ -0,0 +1,32 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/** Node timing scopes and counters are emitted on their own trace channel, so an audio thread spike can be attributed to
+ *  extension node classes in Unreal Insights. They are compiled out of shipping builds. */
+#define METASOUND_EXTENSIONS_TRACE_ENABLED (CPUPROFILERTRACE_ENABLED && COUNTERSTRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if METASOUND_EXTENSIONS_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(MetasoundExtensionsChannel)
+
+/** Times the enclosing scope under a node class event registered in FNodeClassStats. Events are only emitted while both
+ *  the MetasoundExtensions and Cpu channels are enabled. */
+#define METASOUND_EXTENSIONS_TRACE_SCOPE(SpecId) \
+	FCpuProfilerTrace::FEventScope PREPROCESSOR_JOIN(MetasoundExtensionsTraceScope, __LINE__)(SpecId, MetasoundExtensionsChannel, true)
+
+/** Times operator creation for a node class. The event is looked up once per operator type. */
+#define METASOUND_EXTENSIONS_TRACE_CREATE_SCOPE(ClassName) \
+	static const uint32 PREPROCESSOR_JOIN(MetasoundExtensionsCreateSpecId, __LINE__) = ::Metasound::ExtensionsNodeStats::FindOrAddNodeClassStats(ClassName).CreateTraceSpecId; \
+	METASOUND_EXTENSIONS_TRACE_SCOPE(PREPROCESSOR_JOIN(MetasoundExtensionsCreateSpecId, __LINE__))
+
+#else
+
+#define METASOUND_EXTENSIONS_TRACE_SCOPE(SpecId)
+#define METASOUND_EXTENSIONS_TRACE_CREATE_SCOPE(ClassName)
+
+#endif
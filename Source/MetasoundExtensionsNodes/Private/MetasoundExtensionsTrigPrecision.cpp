@@ -0,0 +1,23 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsTrigPrecision.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundExtensionsNodes_TrigPrecision"
+
+namespace Metasound
+{
+	DEFINE_METASOUND_ENUM_BEGIN(ExtensionsMath::ETrigPrecision, FEnumTrigPrecision, "TrigPrecision")
+		DEFINE_METASOUND_ENUM_ENTRY(ExtensionsMath::ETrigPrecision::Fast, "FastDescription", "Fast", "FastDescriptionTT", "Low order polynomial. Max error 6.8e-5, suited to LFOs and modulation."),
+		DEFINE_METASOUND_ENUM_ENTRY(ExtensionsMath::ETrigPrecision::Balanced, "BalancedDescription", "Balanced", "BalancedDescriptionTT", "Single precision polynomial. Max error 1.5e-7 for inputs up to 8192 radians."),
+		DEFINE_METASOUND_ENUM_ENTRY(ExtensionsMath::ETrigPrecision::Exact, "ExactDescription", "Exact", "ExactDescriptionTT", "Full precision library sine. Slowest, within 1 ulp."),
+		DEFINE_METASOUND_ENUM_ENTRY(ExtensionsMath::ETrigPrecision::TableLinear, "TableLinearDescription", "Table (Linear)", "TableLinearDescriptionTT", "Shared sine table with linear interpolation. Max error 5.2e-7 with the default table size."),
+		DEFINE_METASOUND_ENUM_ENTRY(ExtensionsMath::ETrigPrecision::TableCubic, "TableCubicDescription", "Table (Cubic)", "TableCubicDescriptionTT", "Shared sine table with cubic interpolation. Holds its accuracy with small tables."),
+	DEFINE_METASOUND_ENUM_END()
+
+	DEFINE_METASOUND_ENUM_BEGIN(ExtensionsMath::EDecimationInterpolation, FEnumDecimationInterpolation, "DecimationInterpolation")
+		DEFINE_METASOUND_ENUM_ENTRY(ExtensionsMath::EDecimationInterpolation::Linear, "LinearDescription", "Linear", "LinearDescriptionTT", "Straight lines between evaluated frames. Cheapest, for slow modulation."),
+		DEFINE_METASOUND_ENUM_ENTRY(ExtensionsMath::EDecimationInterpolation::Cubic, "CubicDescription", "Cubic", "CubicDescriptionTT", "Curves that follow the slope of the function. Far more accurate for one extra multiply-add per frame."),
+	DEFINE_METASOUND_ENUM_END()
+}
+
+#undef LOCTEXT_NAMESPACE
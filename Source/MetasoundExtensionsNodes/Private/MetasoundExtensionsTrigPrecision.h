@@ -0,0 +1,27 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundExtensionsDecimation.h"
+#include "MetasoundExtensionsMath.h"
+#include "MetasoundParamHelper.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundExtensionsNodes_TrigPrecision"
+
+namespace Metasound
+{
+	/** Precision pin shared by every node family that evaluates sines or cosines through ExtensionsMath. */
+	namespace TrigPrecisionVertexNames
+	{
+		METASOUND_PARAM(InputPrecision, "Precision", "Accuracy of the trigonometric evaluation. Fast and Balanced trade accuracy for speed; Exact uses the full precision library functions.");
+	}
+
+	DECLARE_METASOUND_ENUM(ExtensionsMath::ETrigPrecision, ExtensionsMath::ETrigPrecision::Exact, METASOUNDEXTENSIONSNODES_API,
+		FEnumTrigPrecision, FEnumTrigPrecisionInfo, FEnumTrigPrecisionReadRef, FEnumTrigPrecisionWriteRef);
+
+	DECLARE_METASOUND_ENUM(ExtensionsMath::EDecimationInterpolation, ExtensionsMath::EDecimationInterpolation::Cubic, METASOUNDEXTENSIONSNODES_API,
+		FEnumDecimationInterpolation, FEnumDecimationInterpolationInfo, FEnumDecimationInterpolationReadRef, FEnumDecimationInterpolationWriteRef);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,306 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsUnaryMathNode.h"
+#include "MetasoundTrigger.h"
+
+#include <type_traits>
+
+#define LOCTEXT_NAMESPACE "MetasoundExtensionsNodes_TriggeredUnaryMathNode"
+
+namespace Metasound
+{
+	namespace TriggeredUnaryMathVertexNames
+	{
+		METASOUND_PARAM(InputTrigger, "Trigger", "Evaluates the function on the current input and holds the result until the next trigger.");
+	}
+
+	/** TTriggeredUnaryMathNodeOperator
+	 *
+	 *  Sample-and-hold form of TUnaryMathNodeOperator, driven by the same policies. The function is only evaluated when
+	 *  Trigger fires and the output holds that result in between. Audio outputs switch on the exact trigger frame, using
+	 *  the input sample on that frame; every other type evaluates once per block in which the trigger fires.
+	 *
+	 *  Evaluation count scales with triggers instead of frames, so every data type defaults to the policy's scalar
+	 *  DefaultPrecision. The output is evaluated once on construction and Reset, so it is valid before the first trigger.
+	 */
+	template <typename PolicyType, typename ValueType>
+	class TTriggeredUnaryMathNodeOperator : public TExecutableOperator<TTriggeredUnaryMathNodeOperator<PolicyType, ValueType>>
+	{
+		using FValueTraits = UnaryMathNodePrivate::TUnaryMathValue<ValueType>;
+
+		static constexpr bool bIsAudio = std::is_same_v<ValueType, FAudioBuffer>;
+
+	public:
+		static constexpr ExtensionsMath::ETrigPrecision GetDefaultPrecision()
+		{
+			if constexpr (PolicyType::bHasPrecision)
+			{
+				return PolicyType::DefaultPrecision;
+			}
+			else
+			{
+				return ExtensionsMath::ETrigPrecision::Exact;
+			}
+		}
+
+		static const FVertexInterface& GetDefaultInterface()
+		{
+			auto CreateDefaultInterface = []() -> FVertexInterface
+			{
+				using namespace UnaryMathVertexNames;
+				using namespace TriggeredUnaryMathVertexNames;
+				using namespace TrigPrecisionVertexNames;
+
+				FInputVertexInterface InputInterface;
+				InputInterface.Add(TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputTrigger)));
+				InputInterface.Add(TInputDataVertex<ValueType>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputValue)));
+
+				if constexpr (PolicyType::bHasPrecision)
+				{
+					InputInterface.Add(TInputConstructorVertex<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputPrecision), static_cast<int32>(GetDefaultPrecision())));
+				}
+
+				FOutputVertexInterface OutputInterface;
+				OutputInterface.Add(TOutputDataVertex<ValueType>(METASOUND_GET_PARAM_NAME(OutputValue), FDataVertexMetadata{PolicyType::GetOutputDescription(), METASOUND_GET_PARAM_DISPLAYNAME(OutputValue)}));
+
+				return FVertexInterface(InputInterface, OutputInterface);
+			};
+
+			static const FVertexInterface DefaultInterface = CreateDefaultInterface();
+			return DefaultInterface;
+		}
+
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+			{
+				const FName DataTypeName = GetMetasoundDataTypeName<ValueType>();
+				const FName OperatorName = *FString::Printf(TEXT("%sSampleAndHold"), PolicyType::Name);
+				const FText DataTypeDisplayText = METASOUND_LOCTEXT_FORMAT("SampleAndHoldDataTypePattern", "{0}, Sample and Hold", GetMetasoundDataTypeDisplayText<ValueType>());
+				const FText NodeDisplayName = PolicyType::GetDisplayName(DataTypeDisplayText);
+				const FText NodeDescription = METASOUND_LOCTEXT_FORMAT("SampleAndHoldDescPattern", "{0} Only evaluated when triggered; the output holds its value in between.", PolicyType::GetDescription());
+
+				return UnaryMathNodePrivate::CreateNodeClassMetadata(PolicyType::Name, OperatorName, 1, 0, DataTypeName, NodeDisplayName, NodeDescription, GetDefaultInterface());
+			};
+
+			static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+			return Metadata;
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutResults)
+		{
+			METASOUND_EXTENSIONS_TRACE_CREATE_SCOPE(GetNodeInfo().ClassName);
+
+			using namespace UnaryMathVertexNames;
+			using namespace TriggeredUnaryMathVertexNames;
+			using namespace TrigPrecisionVertexNames;
+
+			const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+			FTriggerReadRef Trigger = InputData.GetOrCreateDefaultDataReadReference<FTrigger>(METASOUND_GET_PARAM_NAME(InputTrigger), InParams.OperatorSettings);
+			TDataReadReference<ValueType> Input = InputData.GetOrCreateDefaultDataReadReference<ValueType>(METASOUND_GET_PARAM_NAME(InputValue), InParams.OperatorSettings);
+
+			const bool bIsConstantTrigger = IsConstantInput(InputData, METASOUND_GET_PARAM_NAME(InputTrigger));
+			const bool bIsConstantValue = IsConstantInput(InputData, METASOUND_GET_PARAM_NAME(InputValue));
+
+			ExtensionsMath::ETrigPrecision Precision = GetDefaultPrecision();
+			if constexpr (PolicyType::bHasPrecision)
+			{
+				Precision = InputData.GetOrCreateDefaultValue<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME(InputPrecision), InParams.OperatorSettings).Get();
+			}
+
+			return MakeUnique<TTriggeredUnaryMathNodeOperator<PolicyType, ValueType>>(InParams.OperatorSettings, Trigger, Input, bIsConstantTrigger, bIsConstantValue, Precision);
+		}
+
+
+		TTriggeredUnaryMathNodeOperator(const FOperatorSettings& InSettings,
+		                                const FTriggerReadRef& InTrigger,
+		                                const TDataReadReference<ValueType>& InInput,
+		                                bool bInIsConstantTrigger,
+		                                bool bInIsConstantValue,
+		                                ExtensionsMath::ETrigPrecision InPrecision)
+			: Trigger(InTrigger)
+			  , Input(InInput)
+			  , OutputValue(TDataWriteReferenceFactory<ValueType>::CreateAny(InSettings))
+			  , NodeClassStats(ExtensionsNodeStats::FindOrAddNodeClassStats(GetNodeInfo().ClassName))
+			  , Precision(InPrecision)
+			  , SinKernel(ExtensionsMath::GetSinKernel(InPrecision))
+			  , bIsConstantTrigger(bInIsConstantTrigger)
+			  , bIsConstantValue(bInIsConstantValue)
+		{
+			NodeClassStats.AddInstance();
+
+			EvaluateInitialValue();
+		}
+
+		virtual ~TTriggeredUnaryMathNodeOperator()
+		{
+			NodeClassStats.RemoveInstance();
+		}
+
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace UnaryMathVertexNames;
+			using namespace TriggeredUnaryMathVertexNames;
+			using namespace TrigPrecisionVertexNames;
+
+			bIsConstantTrigger = BindConstantReadVertex(InOutVertexData, METASOUND_GET_PARAM_NAME(InputTrigger), Trigger, bIsConstantTrigger);
+			bIsConstantValue = BindConstantReadVertex(InOutVertexData, METASOUND_GET_PARAM_NAME(InputValue), Input, bIsConstantValue);
+
+			if constexpr (PolicyType::bHasPrecision)
+			{
+				InOutVertexData.SetValue(METASOUND_GET_PARAM_NAME(InputPrecision), FEnumTrigPrecision(Precision));
+			}
+
+			// A held value survives the rebinding, unless the node now drops out of the render loop and only ever
+			// outputs the value of the new input.
+			if (IsConstantOutput())
+			{
+				EvaluateInitialValue();
+			}
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace UnaryMathVertexNames;
+			InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputValue), OutputValue);
+		}
+
+		virtual IOperator::FExecuteFunction GetExecuteFunction() override
+		{
+			if (IsConstantOutput())
+			{
+				return nullptr;
+			}
+
+			return TExecutableOperator<TTriggeredUnaryMathNodeOperator<PolicyType, ValueType>>::GetExecuteFunction();
+		}
+
+		void Execute()
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ExecuteTraceSpecId);
+			ExtensionsNodeStats::FScopedExecuteTimer ExecuteTimer(NodeClassStats);
+
+			if (!Trigger->IsTriggeredInBlock())
+			{
+				if constexpr (bIsAudio)
+				{
+					FillHeldSample(0, OutputValue->Num());
+				}
+
+				NodeClassStats.RecordSkippedEvaluation();
+				return;
+			}
+
+			if constexpr (bIsAudio)
+			{
+				Trigger->ExecuteBlock(
+					[this](int32 StartFrame, int32 EndFrame)
+					{
+						FillHeldSample(StartFrame, EndFrame);
+					},
+					[this](int32 StartFrame, int32 EndFrame)
+					{
+						HoldSample(StartFrame);
+						bOutputIsUniform = false;
+						FillHeldSample(StartFrame, EndFrame);
+						NodeClassStats.RecordEvaluation();
+					}
+				);
+			}
+			else
+			{
+				// Every trigger in a block sees the same control-rate input, so one evaluation covers them all.
+				FValueTraits::template Evaluate<PolicyType>(*Input, *OutputValue, SinKernel);
+				NodeClassStats.RecordEvaluation();
+			}
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ResetTraceSpecId);
+
+			EvaluateInitialValue();
+		}
+
+	private:
+		/** With either input fixed, the value evaluated on construction is the only one the node can ever output. */
+		bool IsConstantOutput() const
+		{
+			return bIsConstantTrigger || bIsConstantValue;
+		}
+
+		void EvaluateInitialValue()
+		{
+			if constexpr (bIsAudio)
+			{
+				HoldSample(0);
+				bOutputIsUniform = false;
+				FillHeldSample(0, OutputValue->Num());
+			}
+			else
+			{
+				FValueTraits::template Evaluate<PolicyType>(*Input, *OutputValue, SinKernel);
+			}
+		}
+
+		/** Evaluates the input sample on InFrame through the policy's block path, so the held value matches what the
+		 *  untriggered audio node would output on that frame at the same precision. */
+		void HoldSample(const int32 InFrame)
+		{
+			TArrayView<const float> InView(Input->GetData() + InFrame, 1);
+			TArrayView<float> OutView(&HeldSample, 1);
+
+			PolicyType::EvaluateBlock(InView, OutView, SinKernel);
+		}
+
+		/** Writes the held sample to [InStartFrame, InEndFrame). Once a whole block has been filled, the buffer already
+		 *  holds nothing else, so the write is skipped until the next trigger. */
+		void FillHeldSample(const int32 InStartFrame, const int32 InEndFrame)
+		{
+			if (bOutputIsUniform)
+			{
+				return;
+			}
+
+			float* OutData = OutputValue->GetData();
+			for (int32 Frame = InStartFrame; Frame < InEndFrame; ++Frame)
+			{
+				OutData[Frame] = HeldSample;
+			}
+
+			if (InStartFrame == 0 && InEndFrame == OutputValue->Num())
+			{
+				bOutputIsUniform = true;
+			}
+		}
+
+		FTriggerReadRef Trigger;
+		TDataReadReference<ValueType> Input;
+		TDataWriteReference<ValueType> OutputValue;
+
+		ExtensionsNodeStats::FNodeClassStats& NodeClassStats;
+
+		ExtensionsMath::ETrigPrecision Precision = ExtensionsMath::ETrigPrecision::Exact;
+		const ExtensionsMath::FSinKernel& SinKernel;
+
+		// Audio outputs only: the value being held, and whether every frame of the output buffer already holds it.
+		float HeldSample = 0.0f;
+		bool bOutputIsUniform = false;
+
+		bool bIsConstantTrigger = false;
+		bool bIsConstantValue = false;
+	};
+
+	/** TTriggeredUnaryMathNode
+	 *
+	 *  Node facade over TTriggeredUnaryMathNodeOperator, registered next to the TUnaryMathNode aliases of each function.
+	 */
+	template <typename PolicyType, typename ValueType>
+	using TTriggeredUnaryMathNode = TNodeFacade<TTriggeredUnaryMathNodeOperator<PolicyType, ValueType>>;
+}
+
+#undef LOCTEXT_NAMESPACE
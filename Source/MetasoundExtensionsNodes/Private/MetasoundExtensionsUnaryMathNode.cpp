@@ -0,0 +1,31 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsUnaryMathNode.h"
+#include "MetasoundStandardNodesCategories.h"
+#include "MetasoundStandardNodesNames.h"
+
+namespace Metasound
+{
+	namespace UnaryMathNodePrivate
+	{
+		FNodeClassMetadata CreateNodeClassMetadata(const FName& InName, const FName& InOperatorName, int32 InMajorVersion, int32 InMinorVersion, const FName& InDataTypeName, const FText& InDisplayName, const FText& InDescription, const FVertexInterface& InDefaultInterface)
+		{
+			FNodeClassMetadata Metadata
+			{
+				FNodeClassName{InName, InOperatorName, InDataTypeName},
+				InMajorVersion,
+				InMinorVersion,
+				InDisplayName,
+				InDescription,
+				PluginAuthor,
+				PluginNodeMissingPrompt,
+				InDefaultInterface,
+				{NodeCategories::Math},
+				{},
+				FNodeDisplayStyle{}
+			};
+
+			return Metadata;
+		}
+	}
+}
@@ -0,0 +1,351 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundExtensionsArrayOutput.h"
+#include "MetasoundExtensionsInputCache.h"
+#include "MetasoundExtensionsMath.h"
+#include "MetasoundExtensionsNodeStats.h"
+#include "MetasoundExtensionsTrigPrecision.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundTime.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundExtensionsNodes_UnaryMathNode"
+
+namespace Metasound
+{
+	namespace UnaryMathVertexNames
+	{
+		METASOUND_PARAM(InputValue, "Input", "Input value.");
+		METASOUND_PARAM(OutputValue, "Value", "The result for the input value.");
+	}
+
+	namespace UnaryMathNodePrivate
+	{
+		/** Builds the class metadata shared by every node family in the plugin. Kept out of the operator templates so
+		 *  each instantiation does not carry its own copy. */
+		FNodeClassMetadata CreateNodeClassMetadata(const FName& InName, const FName& InOperatorName, int32 InMajorVersion, int32 InMinorVersion, const FName& InDataTypeName, const FText& InDisplayName, const FText& InDescription, const FVertexInterface& InDefaultInterface);
+
+		/** TUnaryMathValue
+		 *
+		 *  Maps a data type onto the policy function that evaluates it: int32 on EvaluateInt32, float on EvaluateFloat,
+		 *  FTime on EvaluateDouble, and audio buffers and float arrays on EvaluateBlock.
+		 */
+		template <typename ValueType>
+		struct TUnaryMathValue
+		{
+			bool bSupported = false;
+		};
+
+		template <>
+		struct TUnaryMathValue<int32>
+		{
+			static constexpr bool bIsBlock = false;
+
+			template <typename PolicyType>
+			static void Evaluate(const int32 In, int32& Out, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				Out = PolicyType::EvaluateInt32(In, InKernel);
+			}
+		};
+
+		template <>
+		struct TUnaryMathValue<float>
+		{
+			static constexpr bool bIsBlock = false;
+
+			template <typename PolicyType>
+			static void Evaluate(const float In, float& Out, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				Out = PolicyType::EvaluateFloat(In, InKernel);
+			}
+		};
+
+		template <>
+		struct TUnaryMathValue<FTime>
+		{
+			static constexpr bool bIsBlock = false;
+
+			template <typename PolicyType>
+			static void Evaluate(const FTime& In, FTime& Out, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				Out = FTime(PolicyType::EvaluateDouble(In.GetSeconds(), InKernel));
+			}
+		};
+
+		template <>
+		struct TUnaryMathValue<FAudioBuffer>
+		{
+			static constexpr bool bIsBlock = true;
+
+			template <typename PolicyType>
+			static void Evaluate(const FAudioBuffer& In, FAudioBuffer& Out, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				TArrayView<float> OutView(Out.GetData(), Out.Num());
+				TArrayView<const float> InView(In.GetData(), Out.Num());
+
+				PolicyType::EvaluateBlock(InView, OutView, InKernel);
+			}
+		};
+
+		template <>
+		struct TUnaryMathValue<TArray<int32>>
+		{
+			static constexpr bool bIsBlock = false;
+
+			template <typename PolicyType>
+			static void Evaluate(const TArray<int32>& In, TArray<int32>& Out, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				TransformArray(In, Out, [&InKernel](const int32 InValue)
+				{
+					return PolicyType::EvaluateInt32(InValue, InKernel);
+				});
+			}
+		};
+
+		template <>
+		struct TUnaryMathValue<TArray<float>>
+		{
+			static constexpr bool bIsBlock = true;
+
+			template <typename PolicyType>
+			static void Evaluate(const TArray<float>& In, TArray<float>& Out, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				ResizeArrayOutput(Out, In.Num());
+				PolicyType::EvaluateBlock(In, Out, InKernel);
+			}
+		};
+
+		template <>
+		struct TUnaryMathValue<TArray<FTime>>
+		{
+			static constexpr bool bIsBlock = false;
+
+			template <typename PolicyType>
+			static void Evaluate(const TArray<FTime>& In, TArray<FTime>& Out, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				TransformArray(In, Out, [&InKernel](const FTime& InValue)
+				{
+					return FTime(PolicyType::EvaluateDouble(InValue.GetSeconds(), InKernel));
+				});
+			}
+		};
+	}
+
+	/** TUnaryMathNodeOperator
+	 *
+	 *  Operator for every node that maps one input to one output of the same type. PolicyType supplies the function:
+	 *
+	 *  Name                    Class namespace and operator name, e.g. TEXT("Sin").
+	 *  MajorVersion            Class version numbers.
+	 *  MinorVersion
+	 *  bHasPrecision           Whether the node has a Precision input. The kernel it selects is passed to every
+	 *                          Evaluate function; without one, the kernel is Exact and can be ignored.
+	 *  DefaultPrecision        Default Precision for int32, float and FTime, and for every type of the sample-and-hold
+	 *                          nodes. Only read when bHasPrecision is set.
+	 *  DefaultBlockPrecision   Default Precision for audio buffers and float arrays. Only read when bHasPrecision is set.
+	 *  GetDisplayName          Node display name, given the display name of the data type.
+	 *  GetDescription          Node description.
+	 *  GetOutputDescription    Tooltip for the Value output.
+	 *  EvaluateInt32           Scalar evaluation for int32 and int32 arrays.
+	 *  EvaluateFloat           Scalar evaluation for float.
+	 *  EvaluateDouble          Scalar evaluation for FTime and time arrays, in seconds.
+	 *  EvaluateBlock           Block evaluation for audio buffers and float arrays. The views may alias.
+	 */
+	template <typename PolicyType, typename ValueType>
+	class TUnaryMathNodeOperator : public TExecutableOperator<TUnaryMathNodeOperator<PolicyType, ValueType>>
+	{
+		using FValueTraits = UnaryMathNodePrivate::TUnaryMathValue<ValueType>;
+
+	public:
+		static constexpr ExtensionsMath::ETrigPrecision GetDefaultPrecision()
+		{
+			if constexpr (PolicyType::bHasPrecision)
+			{
+				return FValueTraits::bIsBlock ? PolicyType::DefaultBlockPrecision : PolicyType::DefaultPrecision;
+			}
+			else
+			{
+				return ExtensionsMath::ETrigPrecision::Exact;
+			}
+		}
+
+		static const FVertexInterface& GetDefaultInterface()
+		{
+			auto CreateDefaultInterface = []() -> FVertexInterface
+			{
+				using namespace UnaryMathVertexNames;
+				using namespace TrigPrecisionVertexNames;
+
+				FInputVertexInterface InputInterface;
+				InputInterface.Add(TInputDataVertex<ValueType>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputValue)));
+
+				if constexpr (PolicyType::bHasPrecision)
+				{
+					InputInterface.Add(TInputConstructorVertex<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputPrecision), static_cast<int32>(GetDefaultPrecision())));
+				}
+
+				FOutputVertexInterface OutputInterface;
+				OutputInterface.Add(TOutputDataVertex<ValueType>(METASOUND_GET_PARAM_NAME(OutputValue), FDataVertexMetadata{PolicyType::GetOutputDescription(), METASOUND_GET_PARAM_DISPLAYNAME(OutputValue)}));
+
+				return FVertexInterface(InputInterface, OutputInterface);
+			};
+
+			static const FVertexInterface DefaultInterface = CreateDefaultInterface();
+			return DefaultInterface;
+		}
+
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+			{
+				const FName DataTypeName = GetMetasoundDataTypeName<ValueType>();
+				const FText NodeDisplayName = PolicyType::GetDisplayName(GetMetasoundDataTypeDisplayText<ValueType>());
+
+				return UnaryMathNodePrivate::CreateNodeClassMetadata(PolicyType::Name, PolicyType::Name, PolicyType::MajorVersion, PolicyType::MinorVersion, DataTypeName, NodeDisplayName, PolicyType::GetDescription(), GetDefaultInterface());
+			};
+
+			static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+			return Metadata;
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutResults)
+		{
+			METASOUND_EXTENSIONS_TRACE_CREATE_SCOPE(GetNodeInfo().ClassName);
+
+			using namespace UnaryMathVertexNames;
+			using namespace TrigPrecisionVertexNames;
+
+			const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+			TDataReadReference<ValueType> Input = InputData.GetOrCreateDefaultDataReadReference<ValueType>(METASOUND_GET_PARAM_NAME(InputValue), InParams.OperatorSettings);
+			const bool bIsConstantInput = IsConstantInput(InputData, METASOUND_GET_PARAM_NAME(InputValue));
+
+			ExtensionsMath::ETrigPrecision Precision = GetDefaultPrecision();
+			if constexpr (PolicyType::bHasPrecision)
+			{
+				Precision = InputData.GetOrCreateDefaultValue<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME(InputPrecision), InParams.OperatorSettings).Get();
+			}
+
+			return MakeUnique<TUnaryMathNodeOperator<PolicyType, ValueType>>(InParams.OperatorSettings, Input, bIsConstantInput, Precision);
+		}
+
+
+		TUnaryMathNodeOperator(const FOperatorSettings& InSettings,
+		                       const TDataReadReference<ValueType>& InInput,
+		                       bool bInIsConstantInput,
+		                       ExtensionsMath::ETrigPrecision InPrecision)
+			: Input(InInput)
+			  , OutputValue(TDataWriteReferenceFactory<ValueType>::CreateAny(InSettings))
+			  , NodeClassStats(ExtensionsNodeStats::FindOrAddNodeClassStats(GetNodeInfo().ClassName))
+			  , Precision(InPrecision)
+			  , SinKernel(ExtensionsMath::GetSinKernel(InPrecision))
+			  , bIsConstantInput(bInIsConstantInput)
+		{
+			NodeClassStats.AddInstance();
+
+			Restart();
+		}
+
+		virtual ~TUnaryMathNodeOperator()
+		{
+			NodeClassStats.RemoveInstance();
+		}
+
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace UnaryMathVertexNames;
+			using namespace TrigPrecisionVertexNames;
+			bIsConstantInput = BindConstantReadVertex(InOutVertexData, METASOUND_GET_PARAM_NAME(InputValue), Input, bIsConstantInput);
+
+			if constexpr (PolicyType::bHasPrecision)
+			{
+				InOutVertexData.SetValue(METASOUND_GET_PARAM_NAME(InputPrecision), FEnumTrigPrecision(Precision));
+			}
+
+			// The input may now be a different reference, so the output is solved again from its current value.
+			Restart();
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace UnaryMathVertexNames;
+			InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputValue), OutputValue);
+		}
+
+		virtual IOperator::FExecuteFunction GetExecuteFunction() override
+		{
+			// A constant input is solved on construction and Reset, so the operator can drop out of the render loop entirely.
+			if (bIsConstantInput)
+			{
+				return nullptr;
+			}
+
+			return TExecutableOperator<TUnaryMathNodeOperator<PolicyType, ValueType>>::GetExecuteFunction();
+		}
+
+		void Evaluate()
+		{
+			FValueTraits::template Evaluate<PolicyType>(*Input, *OutputValue, SinKernel);
+		}
+
+		void Execute()
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ExecuteTraceSpecId);
+			ExtensionsNodeStats::FScopedExecuteTimer ExecuteTimer(NodeClassStats);
+
+			// Control-rate inputs tend to hold their value for many blocks, in which case the output already holds the result.
+			if (InputCache.Update(*Input))
+			{
+				Evaluate();
+				NodeClassStats.RecordEvaluation();
+			}
+			else
+			{
+				NodeClassStats.RecordSkippedEvaluation();
+			}
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ResetTraceSpecId);
+
+			Restart();
+		}
+
+	private:
+		void Restart()
+		{
+			InputCache.Reset();
+			InputCache.Update(*Input);
+			Evaluate();
+		}
+
+		TDataReadReference<ValueType> Input;
+		TDataWriteReference<ValueType> OutputValue;
+
+		TInputCache<ValueType> InputCache;
+		ExtensionsNodeStats::FNodeClassStats& NodeClassStats;
+
+		ExtensionsMath::ETrigPrecision Precision = ExtensionsMath::ETrigPrecision::Exact;
+		const ExtensionsMath::FSinKernel& SinKernel;
+
+		bool bIsConstantInput = false;
+	};
+
+	/** TUnaryMathNode
+	 *
+	 *  Node facade over TUnaryMathNodeOperator. Each function's file defines its policy and registers one alias of
+	 *  this per data type.
+	 */
+	template <typename PolicyType, typename ValueType>
+	using TUnaryMathNode = TNodeFacade<TUnaryMathNodeOperator<PolicyType, ValueType>>;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,533 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundDegSinCosNodes.h"
+#include "MetasoundDegSinNodes.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundExtensionsInputCache.h"
+#include "MetasoundExtensionsMath.h"
+#include "MetasoundExtensionsNodeStats.h"
+#include "MetasoundExtensionsTrigPrecision.h"
+#include "MetasoundExtensionsUnaryMathNode.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundSinCosNodes.h"
+#include "MetasoundSinNodes.h"
+#include "MetasoundUnwindDegreesNodes.h"
+#include "MetasoundUnwindRadiansNodes.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_MultichannelNodes"
+
+namespace Metasound
+{
+	namespace MultichannelVertexNames
+	{
+		METASOUND_PARAM(InputValue, "Input {0}", "Input audio for channel {0}.");
+		METASOUND_PARAM(OutputValue, "Value {0}", "Result for channel {0}.");
+		METASOUND_PARAM(OutputSin, "Sin {0}", "Sine for channel {0}.");
+		METASOUND_PARAM(OutputCos, "Cos {0}", "Cosine for channel {0}.");
+	}
+
+	namespace MetasoundMultichannelNodePrivate
+	{
+		/** Speaker layout names for the channel counts that have one, falling back to a plain count. */
+		FText GetChannelLayoutDisplayText(const int32 InNumChannels)
+		{
+			switch (InNumChannels)
+			{
+				case 2:
+					return METASOUND_LOCTEXT("StereoLayout", "Stereo");
+				case 4:
+					return METASOUND_LOCTEXT("QuadLayout", "Quad");
+				case 6:
+					return METASOUND_LOCTEXT("FivePointOneLayout", "5.1");
+				case 8:
+					return METASOUND_LOCTEXT("SevenPointOneLayout", "7.1");
+				default:
+					return METASOUND_LOCTEXT_FORMAT("ChannelCountLayout", "{0} Channels", InNumChannels);
+			}
+		}
+
+		/** Each family keeps the class namespace of its mono nodes, so the multichannel variants sit next to them, and
+		 *  processes each channel with the block function of the mono node's policy. The version applies to every
+		 *  channel count of the family. */
+		struct FMultichannelSin
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = true;
+			static constexpr bool bSinCos = false;
+
+			static FName GetFamilyName() { return TEXT("Sin"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("MultichannelSinName", "Sin"); }
+			static FText GetDescription() { return METASOUND_LOCTEXT("MultichannelSinDesc", "Returns the sine of every channel's input, in one pass per block."); }
+
+			static void Process(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				MetasoundSinNodePrivate::FSinPolicy::EvaluateBlock(InValues, OutValues, InKernel);
+			}
+		};
+
+		struct FMultichannelDegSin
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = true;
+			static constexpr bool bSinCos = false;
+
+			static FName GetFamilyName() { return TEXT("DegSin"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("MultichannelDegSinName", "Sin (degrees)"); }
+			static FText GetDescription() { return METASOUND_LOCTEXT("MultichannelDegSinDesc", "Returns the sine of every channel's input in degrees, in one pass per block."); }
+
+			static void Process(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				MetasoundDegSinNodePrivate::FDegSinPolicy::EvaluateBlock(InValues, OutValues, InKernel);
+			}
+		};
+
+		struct FMultichannelUnwindDegrees
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = false;
+			static constexpr bool bSinCos = false;
+
+			static FName GetFamilyName() { return TEXT("UnwindDegrees"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("MultichannelUnwindDegreesName", "Unwind Degrees"); }
+			static FText GetDescription() { return METASOUND_LOCTEXT("MultichannelUnwindDegreesDesc", "Wraps every channel's input to [-180, 180) degrees, in one pass per block."); }
+
+			static void Process(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				MetasoundUnwindDegreesNodePrivate::FUnwindDegreesPolicy::EvaluateBlock(InValues, OutValues, InKernel);
+			}
+		};
+
+		struct FMultichannelUnwindRadians
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = false;
+			static constexpr bool bSinCos = false;
+
+			static FName GetFamilyName() { return TEXT("UnwindRadians"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("MultichannelUnwindRadiansName", "Unwind Radians"); }
+			static FText GetDescription() { return METASOUND_LOCTEXT("MultichannelUnwindRadiansDesc", "Wraps every channel's input to [-PI, PI) radians, in one pass per block."); }
+
+			static void Process(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				MetasoundUnwindRadiansNodePrivate::FUnwindRadiansPolicy::EvaluateBlock(InValues, OutValues, InKernel);
+			}
+		};
+
+		/** The sine and cosine families write two outputs per channel from one shared range reduction. */
+		struct FMultichannelSinCos
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = true;
+			static constexpr bool bSinCos = true;
+
+			static FName GetFamilyName() { return TEXT("SinCos"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("MultichannelSinCosName", "SinCos"); }
+			static FText GetDescription() { return METASOUND_LOCTEXT("MultichannelSinCosDesc", "Returns the sine and cosine of every channel's input, in one pass per block."); }
+
+			static void Process(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				MetasoundSinCosNodePrivate::FSinCosPolicy::EvaluateBlock(InValues, OutSinValues, OutCosValues, InKernel);
+			}
+		};
+
+		struct FMultichannelDegSinCos
+		{
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = true;
+			static constexpr bool bSinCos = true;
+
+			static FName GetFamilyName() { return TEXT("DegSinCos"); }
+			static FText GetDisplayName() { return METASOUND_LOCTEXT("MultichannelDegSinCosName", "SinCos (degrees)"); }
+			static FText GetDescription() { return METASOUND_LOCTEXT("MultichannelDegSinCosDesc", "Returns the sine and cosine of every channel's input in degrees, in one pass per block."); }
+
+			static void Process(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				MetasoundDegSinCosNodePrivate::FDegSinCosPolicy::EvaluateBlock(InValues, OutSinValues, OutCosValues, InKernel);
+			}
+		};
+	}
+
+	/** TMultichannelNodeOperator
+	 *
+	 *  Applies one block kernel to NumChannels audio inputs from a single operator. Compared with one mono operator per
+	 *  channel, the graph holds one node, one Execute call and one precision lookup for the whole layout.
+	 */
+	template <typename FamilyType, int32 NumChannels>
+	class TMultichannelNodeOperator : public TExecutableOperator<TMultichannelNodeOperator<FamilyType, NumChannels>>
+	{
+		static_assert(NumChannels > 0, "A multichannel node needs at least one channel");
+
+	public:
+		static const FVertexInterface& GetDefaultInterface()
+		{
+			using namespace MultichannelVertexNames;
+			using namespace TrigPrecisionVertexNames;
+
+			auto CreateDefaultInterface = []() -> FVertexInterface
+			{
+				FInputVertexInterface InputInterface;
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_VARIABLE_PARAM_NAME_AND_METADATA(InputValue, Channel)));
+				}
+
+				if constexpr (FamilyType::bHasPrecision)
+				{
+					InputInterface.Add(TInputConstructorVertex<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputPrecision), static_cast<int32>(ExtensionsMath::ETrigPrecision::Balanced)));
+				}
+
+				FOutputVertexInterface OutputInterface;
+				if constexpr (FamilyType::bSinCos)
+				{
+					for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+					{
+						OutputInterface.Add(TOutputDataVertex<FAudioBuffer>(METASOUND_GET_VARIABLE_PARAM_NAME_AND_METADATA(OutputSin, Channel)));
+					}
+
+					for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+					{
+						OutputInterface.Add(TOutputDataVertex<FAudioBuffer>(METASOUND_GET_VARIABLE_PARAM_NAME_AND_METADATA(OutputCos, Channel)));
+					}
+				}
+				else
+				{
+					for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+					{
+						OutputInterface.Add(TOutputDataVertex<FAudioBuffer>(METASOUND_GET_VARIABLE_PARAM_NAME_AND_METADATA(OutputValue, Channel)));
+					}
+				}
+
+				return FVertexInterface(InputInterface, OutputInterface);
+			};
+
+			static const FVertexInterface DefaultInterface = CreateDefaultInterface();
+			return DefaultInterface;
+		}
+
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+			{
+				const FName OperatorName = *FString::Printf(TEXT("%sMultichannel%d"), *FamilyType::GetFamilyName().ToString(), NumChannels);
+				const FText NodeDisplayName = METASOUND_LOCTEXT_FORMAT("MultichannelDisplayNamePattern", "{0} (Audio, {1})", FamilyType::GetDisplayName(), MetasoundMultichannelNodePrivate::GetChannelLayoutDisplayText(NumChannels));
+
+				return UnaryMathNodePrivate::CreateNodeClassMetadata(FamilyType::GetFamilyName(), OperatorName, FamilyType::MajorVersion, FamilyType::MinorVersion, GetMetasoundDataTypeName<FAudioBuffer>(), NodeDisplayName, FamilyType::GetDescription(), GetDefaultInterface());
+			};
+
+			static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+			return Metadata;
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutResults)
+		{
+			METASOUND_EXTENSIONS_TRACE_CREATE_SCOPE(GetNodeInfo().ClassName);
+
+			using namespace MultichannelVertexNames;
+			using namespace TrigPrecisionVertexNames;
+
+			const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+			TArray<FAudioBufferReadRef> Inputs;
+			TArray<bool> ConstantChannels;
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				const FVertexName InputName = METASOUND_GET_VARIABLE_PARAM_NAME(InputValue, Channel);
+				Inputs.Add(InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(InputName, InParams.OperatorSettings));
+				ConstantChannels.Add(IsConstantInput(InputData, InputName));
+			}
+
+			ExtensionsMath::ETrigPrecision Precision = ExtensionsMath::ETrigPrecision::Balanced;
+			if constexpr (FamilyType::bHasPrecision)
+			{
+				Precision = InputData.GetOrCreateDefaultValue<FEnumTrigPrecision>(METASOUND_GET_PARAM_NAME(InputPrecision), InParams.OperatorSettings).Get();
+			}
+
+			return MakeUnique<TMultichannelNodeOperator<FamilyType, NumChannels>>(InParams.OperatorSettings, MoveTemp(Inputs), MoveTemp(ConstantChannels), Precision);
+		}
+
+
+		TMultichannelNodeOperator(const FOperatorSettings& InSettings,
+		                          TArray<FAudioBufferReadRef>&& InInputs,
+		                          TArray<bool>&& InConstantChannels,
+		                          ExtensionsMath::ETrigPrecision InPrecision)
+			: Inputs(MoveTemp(InInputs))
+			  , NodeClassStats(ExtensionsNodeStats::FindOrAddNodeClassStats(GetNodeInfo().ClassName))
+			  , Precision(InPrecision)
+			  , SinKernel(ExtensionsMath::GetSinKernel(InPrecision))
+			  , SinCosKernel(ExtensionsMath::GetSinCosKernel(InPrecision))
+			  , ConstantChannels(MoveTemp(InConstantChannels))
+		{
+			check(Inputs.Num() == NumChannels);
+			check(ConstantChannels.Num() == NumChannels);
+
+			NodeClassStats.AddInstance();
+
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Outputs.Add(FAudioBufferWriteRef::CreateNew(InSettings));
+
+				if constexpr (FamilyType::bSinCos)
+				{
+					CosOutputs.Add(FAudioBufferWriteRef::CreateNew(InSettings));
+				}
+			}
+
+			ProcessChannels();
+		}
+
+		virtual ~TMultichannelNodeOperator()
+		{
+			NodeClassStats.RemoveInstance();
+		}
+
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace MultichannelVertexNames;
+			using namespace TrigPrecisionVertexNames;
+
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				ConstantChannels[Channel] = BindConstantReadVertex(InOutVertexData, METASOUND_GET_VARIABLE_PARAM_NAME(InputValue, Channel), Inputs[Channel], ConstantChannels[Channel]);
+			}
+
+			if constexpr (FamilyType::bHasPrecision)
+			{
+				InOutVertexData.SetValue(METASOUND_GET_PARAM_NAME(InputPrecision), FEnumTrigPrecision(Precision));
+			}
+
+			// Any channel may now read a different buffer, so the outputs are solved again from them.
+			ProcessChannels();
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace MultichannelVertexNames;
+
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				if constexpr (FamilyType::bSinCos)
+				{
+					InOutVertexData.BindReadVertex(METASOUND_GET_VARIABLE_PARAM_NAME(OutputSin, Channel), Outputs[Channel]);
+					InOutVertexData.BindReadVertex(METASOUND_GET_VARIABLE_PARAM_NAME(OutputCos, Channel), CosOutputs[Channel]);
+				}
+				else
+				{
+					InOutVertexData.BindReadVertex(METASOUND_GET_VARIABLE_PARAM_NAME(OutputValue, Channel), Outputs[Channel]);
+				}
+			}
+		}
+
+		virtual IOperator::FExecuteFunction GetExecuteFunction() override
+		{
+			// Unconnected channels hold silence, so with every channel constant the outputs never change after construction.
+			if (!ConstantChannels.Contains(false))
+			{
+				return nullptr;
+			}
+
+			return TExecutableOperator<TMultichannelNodeOperator<FamilyType, NumChannels>>::GetExecuteFunction();
+		}
+
+		void ProcessChannels()
+		{
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				const FAudioBuffer& InBuffer = *Inputs[Channel];
+				FAudioBuffer& OutBuffer = *Outputs[Channel];
+
+				TArrayView<const float> InView(InBuffer.GetData(), OutBuffer.Num());
+				TArrayView<float> OutView(OutBuffer.GetData(), OutBuffer.Num());
+
+				if constexpr (FamilyType::bSinCos)
+				{
+					FAudioBuffer& OutCosBuffer = *CosOutputs[Channel];
+					TArrayView<float> OutCosView(OutCosBuffer.GetData(), OutCosBuffer.Num());
+					FamilyType::Process(InView, OutView, OutCosView, SinCosKernel);
+				}
+				else
+				{
+					FamilyType::Process(InView, OutView, SinKernel);
+				}
+			}
+		}
+
+		void Execute()
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ExecuteTraceSpecId);
+			ExtensionsNodeStats::FScopedExecuteTimer ExecuteTimer(NodeClassStats);
+
+			ProcessChannels();
+			NodeClassStats.RecordEvaluation();
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ResetTraceSpecId);
+
+			ProcessChannels();
+		}
+
+	private:
+		TArray<FAudioBufferReadRef> Inputs;
+
+		// One result per channel, the sines for the sine and cosine families. CosOutputs is only filled for those.
+		TArray<FAudioBufferWriteRef> Outputs;
+		TArray<FAudioBufferWriteRef> CosOutputs;
+
+		ExtensionsNodeStats::FNodeClassStats& NodeClassStats;
+
+		ExtensionsMath::ETrigPrecision Precision = ExtensionsMath::ETrigPrecision::Balanced;
+		const ExtensionsMath::FSinKernel& SinKernel;
+		const ExtensionsMath::FSinCosKernel& SinCosKernel;
+
+		// Whether each channel's input is unconnected or a literal.
+		TArray<bool> ConstantChannels;
+	};
+
+	/** TMultichannelNode
+	 *
+	 *  One node for a whole speaker layout. MetaSound fixes a node class's pins when it registers, so every channel
+	 *  count from 2 to 8 is registered as its own class, covering stereo, quad, 5.1 and 7.1 and the counts in between.
+	 */
+	template <typename FamilyType, int32 NumChannels>
+	using TMultichannelNode = TNodeFacade<TMultichannelNodeOperator<FamilyType, NumChannels>>;
+
+	using FSinNodeStereo = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSin, 2>;
+	METASOUND_REGISTER_NODE(FSinNodeStereo)
+
+	using FSinNodeThreeChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSin, 3>;
+	METASOUND_REGISTER_NODE(FSinNodeThreeChannel)
+
+	using FSinNodeQuad = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSin, 4>;
+	METASOUND_REGISTER_NODE(FSinNodeQuad)
+
+	using FSinNodeFiveChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSin, 5>;
+	METASOUND_REGISTER_NODE(FSinNodeFiveChannel)
+
+	using FSinNodeFivePointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSin, 6>;
+	METASOUND_REGISTER_NODE(FSinNodeFivePointOne)
+
+	using FSinNodeSevenChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSin, 7>;
+	METASOUND_REGISTER_NODE(FSinNodeSevenChannel)
+
+	using FSinNodeSevenPointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSin, 8>;
+	METASOUND_REGISTER_NODE(FSinNodeSevenPointOne)
+
+	using FDegSinNodeStereo = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSin, 2>;
+	METASOUND_REGISTER_NODE(FDegSinNodeStereo)
+
+	using FDegSinNodeThreeChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSin, 3>;
+	METASOUND_REGISTER_NODE(FDegSinNodeThreeChannel)
+
+	using FDegSinNodeQuad = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSin, 4>;
+	METASOUND_REGISTER_NODE(FDegSinNodeQuad)
+
+	using FDegSinNodeFiveChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSin, 5>;
+	METASOUND_REGISTER_NODE(FDegSinNodeFiveChannel)
+
+	using FDegSinNodeFivePointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSin, 6>;
+	METASOUND_REGISTER_NODE(FDegSinNodeFivePointOne)
+
+	using FDegSinNodeSevenChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSin, 7>;
+	METASOUND_REGISTER_NODE(FDegSinNodeSevenChannel)
+
+	using FDegSinNodeSevenPointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSin, 8>;
+	METASOUND_REGISTER_NODE(FDegSinNodeSevenPointOne)
+
+	using FUnwindDegreesNodeStereo = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindDegrees, 2>;
+	METASOUND_REGISTER_NODE(FUnwindDegreesNodeStereo)
+
+	using FUnwindDegreesNodeThreeChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindDegrees, 3>;
+	METASOUND_REGISTER_NODE(FUnwindDegreesNodeThreeChannel)
+
+	using FUnwindDegreesNodeQuad = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindDegrees, 4>;
+	METASOUND_REGISTER_NODE(FUnwindDegreesNodeQuad)
+
+	using FUnwindDegreesNodeFiveChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindDegrees, 5>;
+	METASOUND_REGISTER_NODE(FUnwindDegreesNodeFiveChannel)
+
+	using FUnwindDegreesNodeFivePointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindDegrees, 6>;
+	METASOUND_REGISTER_NODE(FUnwindDegreesNodeFivePointOne)
+
+	using FUnwindDegreesNodeSevenChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindDegrees, 7>;
+	METASOUND_REGISTER_NODE(FUnwindDegreesNodeSevenChannel)
+
+	using FUnwindDegreesNodeSevenPointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindDegrees, 8>;
+	METASOUND_REGISTER_NODE(FUnwindDegreesNodeSevenPointOne)
+
+	using FUnwindRadiansNodeStereo = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindRadians, 2>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeStereo)
+
+	using FUnwindRadiansNodeThreeChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindRadians, 3>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeThreeChannel)
+
+	using FUnwindRadiansNodeQuad = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindRadians, 4>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeQuad)
+
+	using FUnwindRadiansNodeFiveChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindRadians, 5>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeFiveChannel)
+
+	using FUnwindRadiansNodeFivePointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindRadians, 6>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeFivePointOne)
+
+	using FUnwindRadiansNodeSevenChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindRadians, 7>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeSevenChannel)
+
+	using FUnwindRadiansNodeSevenPointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelUnwindRadians, 8>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeSevenPointOne)
+
+	using FSinCosNodeStereo = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSinCos, 2>;
+	METASOUND_REGISTER_NODE(FSinCosNodeStereo)
+
+	using FSinCosNodeThreeChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSinCos, 3>;
+	METASOUND_REGISTER_NODE(FSinCosNodeThreeChannel)
+
+	using FSinCosNodeQuad = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSinCos, 4>;
+	METASOUND_REGISTER_NODE(FSinCosNodeQuad)
+
+	using FSinCosNodeFiveChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSinCos, 5>;
+	METASOUND_REGISTER_NODE(FSinCosNodeFiveChannel)
+
+	using FSinCosNodeFivePointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSinCos, 6>;
+	METASOUND_REGISTER_NODE(FSinCosNodeFivePointOne)
+
+	using FSinCosNodeSevenChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSinCos, 7>;
+	METASOUND_REGISTER_NODE(FSinCosNodeSevenChannel)
+
+	using FSinCosNodeSevenPointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelSinCos, 8>;
+	METASOUND_REGISTER_NODE(FSinCosNodeSevenPointOne)
+
+	using FDegSinCosNodeStereo = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSinCos, 2>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeStereo)
+
+	using FDegSinCosNodeThreeChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSinCos, 3>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeThreeChannel)
+
+	using FDegSinCosNodeQuad = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSinCos, 4>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeQuad)
+
+	using FDegSinCosNodeFiveChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSinCos, 5>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeFiveChannel)
+
+	using FDegSinCosNodeFivePointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSinCos, 6>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeFivePointOne)
+
+	using FDegSinCosNodeSevenChannel = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSinCos, 7>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeSevenChannel)
+
+	using FDegSinCosNodeSevenPointOne = TMultichannelNode<MetasoundMultichannelNodePrivate::FMultichannelDegSinCos, 8>;
+	METASOUND_REGISTER_NODE(FDegSinCosNodeSevenPointOne)
+}
+
+#undef LOCTEXT_NAMESPACE
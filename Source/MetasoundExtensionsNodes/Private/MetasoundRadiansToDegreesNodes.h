@@ -0,0 +1,58 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsUnaryMathNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_RadiansToDegreesNode"
+
+namespace Metasound
+{
+	namespace MetasoundRadiansToDegreesNodePrivate
+	{
+		struct FRadiansToDegreesPolicy
+		{
+			static constexpr const TCHAR* Name = TEXT("RadiansToDegrees");
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = false;
+
+			static FText GetDisplayName(const FText& InDataTypeDisplayText)
+			{
+				return METASOUND_LOCTEXT_FORMAT("RadiansToDegreesDisplayNamePattern", "Radians To Degrees ({0})", InDataTypeDisplayText);
+			}
+
+			static FText GetDescription()
+			{
+				return METASOUND_LOCTEXT("RadiansToDegreesDesc", "Returns the degree value corresponding to the input radian value.");
+			}
+
+			static FText GetOutputDescription()
+			{
+				return METASOUND_LOCTEXT("OutputValueTooltip", "The value in degrees corresponding to the input radian value.");
+			}
+
+			static int32 EvaluateInt32(const int32 In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return static_cast<int32>(FMath::RadiansToDegrees(static_cast<float>(In)));
+			}
+
+			static float EvaluateFloat(const float In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return FMath::RadiansToDegrees(In);
+			}
+
+			static double EvaluateDouble(const double In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return FMath::RadiansToDegrees(In);
+			}
+
+			static void EvaluateBlock(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				ExtensionsMath::ArrayScale(InValues, OutValues, 180.0f / UE_PI);
+			}
+		};
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
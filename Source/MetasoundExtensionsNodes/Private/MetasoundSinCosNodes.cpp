@@ -0,0 +1,27 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundSinCosNodes.h"
+
+#include "MetasoundNodeRegistrationMacro.h"
+
+namespace Metasound
+{
+	/** TSinCosRadiansNode
+	 *
+	 *  Returns the sine and cosine of the input value from a single shared range reduction.
+	 */
+	template <typename ValueType>
+	using TSinCosRadiansNode = TSinCosNode<MetasoundSinCosNodePrivate::FSinCosPolicy, ValueType>;
+
+	using FSinCosNodeInt32 = TSinCosRadiansNode<int32>;
+	METASOUND_REGISTER_NODE(FSinCosNodeInt32)
+
+	using FSinCosNodeFloat = TSinCosRadiansNode<float>;
+	METASOUND_REGISTER_NODE(FSinCosNodeFloat)
+
+	using FSinCosNodeTime = TSinCosRadiansNode<FTime>;
+	METASOUND_REGISTER_NODE(FSinCosNodeTime)
+
+	using FSinCosNodeAudioBuffer = TSinCosRadiansNode<FAudioBuffer>;
+	METASOUND_REGISTER_NODE(FSinCosNodeAudioBuffer)
+}
@@ -0,0 +1,59 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsSinCosNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_SinCosNode"
+
+namespace Metasound
+{
+	namespace MetasoundSinCosNodePrivate
+	{
+		struct FSinCosPolicy
+		{
+			static constexpr const TCHAR* Name = TEXT("SinCos");
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr ExtensionsMath::ETrigPrecision DefaultPrecision = ExtensionsMath::ETrigPrecision::Exact;
+			static constexpr ExtensionsMath::ETrigPrecision DefaultBlockPrecision = ExtensionsMath::ETrigPrecision::Balanced;
+
+			static FText GetDisplayName(const FText& InDataTypeDisplayText)
+			{
+				return METASOUND_LOCTEXT_FORMAT("SinCosDisplayNamePattern", "SinCos ({0})", InDataTypeDisplayText);
+			}
+
+			static FText GetDescription()
+			{
+				return METASOUND_LOCTEXT("SinCosDesc", "Returns the sine and cosine of the input value from a single shared range reduction.");
+			}
+
+			static FText GetInputDescription()
+			{
+				return METASOUND_LOCTEXT("InputValueTooltip", "Input value in radians.");
+			}
+
+			static void EvaluateInt32(const int32 In, float& OutSin, float& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				InKernel.SinCos(static_cast<float>(In), OutSin, OutCos);
+			}
+
+			static void EvaluateFloat(const float In, float& OutSin, float& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				InKernel.SinCos(In, OutSin, OutCos);
+			}
+
+			static void EvaluateDouble(const double In, double& OutSin, double& OutCos, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				InKernel.SinCosDouble(In, OutSin, OutCos);
+			}
+
+			static void EvaluateBlock(TArrayView<const float> InValues, TArrayView<float> OutSinValues, TArrayView<float> OutCosValues, const ExtensionsMath::FSinCosKernel& InKernel)
+			{
+				InKernel.ArraySinCos(InValues, OutSinValues, OutCosValues, 1.0f);
+			}
+		};
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,60 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsUnaryMathNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_SinNode"
+
+namespace Metasound
+{
+	namespace MetasoundSinNodePrivate
+	{
+		struct FSinPolicy
+		{
+			static constexpr const TCHAR* Name = TEXT("Sin");
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 1;
+			static constexpr bool bHasPrecision = true;
+			static constexpr ExtensionsMath::ETrigPrecision DefaultPrecision = ExtensionsMath::ETrigPrecision::Exact;
+			static constexpr ExtensionsMath::ETrigPrecision DefaultBlockPrecision = ExtensionsMath::ETrigPrecision::Balanced;
+
+			static FText GetDisplayName(const FText& InDataTypeDisplayText)
+			{
+				return METASOUND_LOCTEXT_FORMAT("SinDisplayNamePattern", "Sin ({0})", InDataTypeDisplayText);
+			}
+
+			static FText GetDescription()
+			{
+				return METASOUND_LOCTEXT("SinDesc", "Returns the sine of the input value.");
+			}
+
+			static FText GetOutputDescription()
+			{
+				return METASOUND_LOCTEXT("OutputValueTooltip", "The solved sine of the input.");
+			}
+
+			static int32 EvaluateInt32(const int32 In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return static_cast<int32>(InKernel.Sin(static_cast<float>(In)));
+			}
+
+			static float EvaluateFloat(const float In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return InKernel.Sin(In);
+			}
+
+			static double EvaluateDouble(const double In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return InKernel.SinDouble(In);
+			}
+
+			static void EvaluateBlock(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				InKernel.ArraySin(InValues, OutValues, 1.0f);
+			}
+		};
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,235 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundExtensionsInputCache.h"
+#include "MetasoundExtensionsMath.h"
+#include "MetasoundExtensionsNodeStats.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundStandardNodesCategories.h"
+#include "MetasoundStandardNodesNames.h"
+#include "MetasoundTrigger.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_SineOscillatorNode"
+
+namespace Metasound
+{
+	namespace SineOscillatorVertexNames
+	{
+		METASOUND_PARAM(InputFrequency, "Frequency", "Frequency of the oscillator in Hz. Clamped to the Nyquist frequency.");
+		METASOUND_PARAM(InputPhaseReset, "Phase Reset", "Restarts the oscillator at the phase offset, on the exact sample of the trigger.");
+		METASOUND_PARAM(InputPhaseOffset, "Phase Offset", "Phase offset in degrees.");
+		METASOUND_PARAM(OutputAudio, "Audio", "The generated sine wave.");
+	}
+
+	namespace MetasoundSineOscillatorNodePrivate
+	{
+		FNodeClassMetadata CreateNodeClassMetadata(const FName& InDataTypeName, const FName& InOperatorName, const FText& InDisplayName, const FText& InDescription, const FVertexInterface& InDefaultInterface)
+		{
+			FNodeClassMetadata Metadata
+			{
+				FNodeClassName{"SineOscillator", InOperatorName, InDataTypeName},
+				1, // Major Version
+				0, // Minor Version
+				InDisplayName,
+				InDescription,
+				PluginAuthor,
+				PluginNodeMissingPrompt,
+				InDefaultInterface,
+				{NodeCategories::Generators},
+				{},
+				FNodeDisplayStyle{}
+			};
+
+			return Metadata;
+		}
+	}
+
+	class FSineOscillatorNodeOperator : public TExecutableOperator<FSineOscillatorNodeOperator>
+	{
+	public:
+		static const FVertexInterface& GetDefaultInterface()
+		{
+			using namespace SineOscillatorVertexNames;
+
+			static const FVertexInterface DefaultInterface(
+				FInputVertexInterface(
+					TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputFrequency), 440.0f),
+					TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputPhaseReset)),
+					TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputPhaseOffset), 0.0f)
+				),
+				FOutputVertexInterface(
+					TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputAudio))
+				)
+			);
+
+			return DefaultInterface;
+		}
+
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+			{
+				const FName DataTypeName = GetMetasoundDataTypeName<FAudioBuffer>();
+				const FName OperatorName = TEXT("SineOscillator");
+				const FText NodeDisplayName = METASOUND_LOCTEXT("SineOscillatorDisplayName", "Sine Oscillator");
+				const FText NodeDescription = METASOUND_LOCTEXT("SineOscillatorDesc", "Generates a sine wave with a rotating phasor, at the cost of a few multiply-adds per sample.");
+				const FVertexInterface NodeInterface = GetDefaultInterface();
+
+				return MetasoundSineOscillatorNodePrivate::CreateNodeClassMetadata(DataTypeName, OperatorName, NodeDisplayName, NodeDescription, NodeInterface);
+			};
+
+			static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+			return Metadata;
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutResults)
+		{
+			METASOUND_EXTENSIONS_TRACE_CREATE_SCOPE(GetNodeInfo().ClassName);
+
+			using namespace SineOscillatorVertexNames;
+
+			const FInputVertexInterfaceData& InputData = InParams.InputData;
+			TDataReadReference<float> Frequency = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputFrequency), InParams.OperatorSettings);
+			TDataReadReference<FTrigger> PhaseReset = InputData.GetOrCreateDefaultDataReadReference<FTrigger>(METASOUND_GET_PARAM_NAME(InputPhaseReset), InParams.OperatorSettings);
+			TDataReadReference<float> PhaseOffset = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputPhaseOffset), InParams.OperatorSettings);
+
+			return MakeUnique<FSineOscillatorNodeOperator>(InParams.OperatorSettings, Frequency, PhaseReset, PhaseOffset);
+		}
+
+
+		FSineOscillatorNodeOperator(const FOperatorSettings& InSettings,
+		                            const TDataReadReference<float>& InFrequency,
+		                            const TDataReadReference<FTrigger>& InPhaseReset,
+		                            const TDataReadReference<float>& InPhaseOffset)
+			: Frequency(InFrequency)
+			  , PhaseReset(InPhaseReset)
+			  , PhaseOffset(InPhaseOffset)
+			  , OutputAudio(TDataWriteReferenceFactory<FAudioBuffer>::CreateAny(InSettings))
+			  , NodeClassStats(ExtensionsNodeStats::FindOrAddNodeClassStats(GetNodeInfo().ClassName))
+			  , SampleRate(InSettings.GetSampleRate())
+		{
+			NodeClassStats.AddInstance();
+
+			RestartOscillator();
+		}
+
+		virtual ~FSineOscillatorNodeOperator()
+		{
+			NodeClassStats.RemoveInstance();
+		}
+
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace SineOscillatorVertexNames;
+			InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputFrequency), Frequency);
+			InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputPhaseReset), PhaseReset);
+			InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputPhaseOffset), PhaseOffset);
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace SineOscillatorVertexNames;
+			InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputAudio), OutputAudio);
+		}
+
+		void Execute()
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ExecuteTraceSpecId);
+			ExtensionsNodeStats::FScopedExecuteTimer ExecuteTimer(NodeClassStats);
+
+			if (FrequencyCache.Update(*Frequency))
+			{
+				UpdateStep();
+			}
+
+			// Offset changes shift the running phase rather than restarting it, so the output stays continuous.
+			if (*PhaseOffset != LastPhaseOffset)
+			{
+				Oscillator.SetPhase(Oscillator.GetPhase() + DegreesToRadians(*PhaseOffset - LastPhaseOffset));
+				LastPhaseOffset = *PhaseOffset;
+			}
+
+			PhaseReset->ExecuteBlock(
+				[this](int32 StartFrame, int32 EndFrame)
+				{
+					Generate(StartFrame, EndFrame);
+				},
+				[this](int32 StartFrame, int32 EndFrame)
+				{
+					Oscillator.SetPhase(DegreesToRadians(LastPhaseOffset));
+					Generate(StartFrame, EndFrame);
+				}
+			);
+
+			Oscillator.Resync();
+			NodeClassStats.RecordEvaluation();
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ResetTraceSpecId);
+
+			OutputAudio->Zero();
+			RestartOscillator();
+		}
+
+	private:
+		static double DegreesToRadians(float InDegrees)
+		{
+			return UE_DOUBLE_PI / 180.0 * static_cast<double>(InDegrees);
+		}
+
+		void RestartOscillator()
+		{
+			FrequencyCache.Reset();
+			FrequencyCache.Update(*Frequency);
+			UpdateStep();
+
+			LastPhaseOffset = *PhaseOffset;
+			Oscillator.SetPhase(DegreesToRadians(LastPhaseOffset));
+		}
+
+		void UpdateStep()
+		{
+			const float Nyquist = 0.5f * SampleRate;
+			const float ClampedFrequency = FMath::Clamp(*Frequency, -Nyquist, Nyquist);
+
+			Oscillator.SetStep(UE_DOUBLE_TWO_PI * static_cast<double>(ClampedFrequency) / static_cast<double>(SampleRate));
+		}
+
+		void Generate(int32 InStartFrame, int32 InEndFrame)
+		{
+			if (InEndFrame > InStartFrame)
+			{
+				Oscillator.Generate(TArrayView<float>(OutputAudio->GetData() + InStartFrame, InEndFrame - InStartFrame));
+			}
+		}
+
+		TDataReadReference<float> Frequency;
+		TDataReadReference<FTrigger> PhaseReset;
+		TDataReadReference<float> PhaseOffset;
+		TDataWriteReference<FAudioBuffer> OutputAudio;
+
+		TInputCache<float> FrequencyCache;
+		ExtensionsNodeStats::FNodeClassStats& NodeClassStats;
+
+		ExtensionsMath::FRotationOscillator Oscillator;
+		float SampleRate = 48000.0f;
+		float LastPhaseOffset = 0.0f;
+	};
+
+	/** FSineOscillatorNode
+	 *
+	 *  Generates a sine wave with a rotating phasor, at the cost of a few multiply-adds per sample.
+	 */
+	using FSineOscillatorNode = TNodeFacade<FSineOscillatorNodeOperator>;
+	METASOUND_REGISTER_NODE(FSineOscillatorNode)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,313 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundExtensionsInputCache.h"
+#include "MetasoundExtensionsMath.h"
+#include "MetasoundExtensionsNodeStats.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundStandardNodesCategories.h"
+#include "MetasoundStandardNodesNames.h"
+#include "MetasoundTime.h"
+
+#include <type_traits>
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_TimeSineNode"
+
+namespace Metasound
+{
+	namespace TimeSineVertexNames
+	{
+		METASOUND_PARAM(InputTime, "Time", "Time the sine is evaluated at. The audio output follows the rate Time moves at, and holds its value while Time stands still.");
+		METASOUND_PARAM(InputFrequency, "Frequency", "Frequency in Hz. Changes continue from the current phase instead of jumping.");
+		METASOUND_PARAM(OutputValue, "Value", "sin(2 * PI * Frequency * Time).");
+	}
+
+	namespace MetasoundTimeSineNodePrivate
+	{
+		FNodeClassMetadata CreateNodeClassMetadata(const FName& InDataTypeName, const FText& InDisplayName, const FText& InDescription, const FVertexInterface& InDefaultInterface)
+		{
+			FNodeClassMetadata Metadata
+			{
+				FNodeClassName{"TimeSine", "TimeSine", InDataTypeName},
+				1, // Major Version
+				0, // Minor Version
+				InDisplayName,
+				InDescription,
+				PluginAuthor,
+				PluginNodeMissingPrompt,
+				InDefaultInterface,
+				{NodeCategories::Generators},
+				{},
+				FNodeDisplayStyle{}
+			};
+
+			return Metadata;
+		}
+	}
+
+	/** TTimeSineNodeOperator
+	 *
+	 *  Outputs sin(2 * PI * f * t) for a time input, with the phase tracked in double precision turns by
+	 *  ExtensionsMath::FTimePhase. The phase is advanced once per block by the time elapsed since the previous one, so
+	 *  there is no double math per sample and no loss of precision however long the time input has been running.
+	 *
+	 *  The float output evaluates the sine once per block and skips blocks where the phase did not move. The audio output
+	 *  restarts a rotation oscillator at the block's phase and runs it at the rate the phase moved over the last block,
+	 *  so it is continuous whenever Time moves at a steady rate, whether that of a clock, a slowed one or none at all.
+	 *  Its frequency is clamped to the Nyquist frequency.
+	 */
+	template <typename OutputType>
+	class TTimeSineNodeOperator : public TExecutableOperator<TTimeSineNodeOperator<OutputType>>
+	{
+		static constexpr bool bIsAudio = std::is_same_v<OutputType, FAudioBuffer>;
+
+	public:
+		static const FVertexInterface& GetDefaultInterface()
+		{
+			using namespace TimeSineVertexNames;
+
+			static const FVertexInterface DefaultInterface(
+				FInputVertexInterface(
+					TInputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputTime)),
+					TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputFrequency), 1.0f)
+				),
+				FOutputVertexInterface(
+					TOutputDataVertex<OutputType>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputValue))
+				)
+			);
+
+			return DefaultInterface;
+		}
+
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+			{
+				const FName DataTypeName = GetMetasoundDataTypeName<OutputType>();
+				const FText NodeDisplayName = METASOUND_LOCTEXT_FORMAT("TimeSineDisplayNamePattern", "Time Sine ({0})", GetMetasoundDataTypeDisplayText<OutputType>());
+				const FText NodeDescription = METASOUND_LOCTEXT("TimeSineDesc", "Returns sin(2 * PI * Frequency * Time), with the phase kept in double precision so it stays accurate after days of uptime.");
+				const FVertexInterface NodeInterface = GetDefaultInterface();
+
+				return MetasoundTimeSineNodePrivate::CreateNodeClassMetadata(DataTypeName, NodeDisplayName, NodeDescription, NodeInterface);
+			};
+
+			static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+			return Metadata;
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutResults)
+		{
+			METASOUND_EXTENSIONS_TRACE_CREATE_SCOPE(GetNodeInfo().ClassName);
+
+			using namespace TimeSineVertexNames;
+
+			const FInputVertexInterfaceData& InputData = InParams.InputData;
+			FTimeReadRef Time = InputData.GetOrCreateDefaultDataReadReference<FTime>(METASOUND_GET_PARAM_NAME(InputTime), InParams.OperatorSettings);
+			FFloatReadRef Frequency = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputFrequency), InParams.OperatorSettings);
+
+			const bool bIsConstantTime = IsConstantInput(InputData, METASOUND_GET_PARAM_NAME(InputTime));
+			const bool bIsConstantFrequency = IsConstantInput(InputData, METASOUND_GET_PARAM_NAME(InputFrequency));
+
+			return MakeUnique<TTimeSineNodeOperator<OutputType>>(InParams.OperatorSettings, Time, Frequency, bIsConstantTime, bIsConstantFrequency);
+		}
+
+
+		TTimeSineNodeOperator(const FOperatorSettings& InSettings,
+		                      const FTimeReadRef& InTime,
+		                      const FFloatReadRef& InFrequency,
+		                      bool bInIsConstantTime,
+		                      bool bInIsConstantFrequency)
+			: Time(InTime)
+			  , Frequency(InFrequency)
+			  , OutputValue(TDataWriteReferenceFactory<OutputType>::CreateAny(InSettings))
+			  , NodeClassStats(ExtensionsNodeStats::FindOrAddNodeClassStats(GetNodeInfo().ClassName))
+			  , SampleRate(InSettings.GetSampleRate())
+			  , bIsConstantTime(bInIsConstantTime)
+			  , bIsConstantFrequency(bInIsConstantFrequency)
+		{
+			NodeClassStats.AddInstance();
+
+			Restart();
+		}
+
+		virtual ~TTimeSineNodeOperator()
+		{
+			NodeClassStats.RemoveInstance();
+		}
+
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace TimeSineVertexNames;
+			bIsConstantTime = BindConstantReadVertex(InOutVertexData, METASOUND_GET_PARAM_NAME(InputTime), Time, bIsConstantTime);
+			bIsConstantFrequency = BindConstantReadVertex(InOutVertexData, METASOUND_GET_PARAM_NAME(InputFrequency), Frequency, bIsConstantFrequency);
+
+			// Either input may now be a different reference, so the phase starts over from their current values.
+			Restart();
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			using namespace TimeSineVertexNames;
+			InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputValue), OutputValue);
+		}
+
+		virtual IOperator::FExecuteFunction GetExecuteFunction() override
+		{
+			// A fixed time and frequency leave the float output at the value evaluated on construction.
+			if (!bIsAudio && bIsConstantTime && bIsConstantFrequency)
+			{
+				return nullptr;
+			}
+
+			return TExecutableOperator<TTimeSineNodeOperator<OutputType>>::GetExecuteFunction();
+		}
+
+		void Execute()
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ExecuteTraceSpecId);
+			ExtensionsNodeStats::FScopedExecuteTimer ExecuteTimer(NodeClassStats);
+
+			if (FrequencyCache.Update(*Frequency))
+			{
+				UpdateFrequency();
+			}
+
+			const bool bMoved = Phase.Advance(Time->GetSeconds(), ClampedFrequency);
+
+			if constexpr (bIsAudio)
+			{
+				UpdateStep();
+				Generate();
+				NodeClassStats.RecordEvaluation();
+			}
+			else if (bMoved)
+			{
+				*OutputValue = EvaluateValue();
+				NodeClassStats.RecordEvaluation();
+			}
+			else
+			{
+				NodeClassStats.RecordSkippedEvaluation();
+			}
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			METASOUND_EXTENSIONS_TRACE_SCOPE(NodeClassStats.ResetTraceSpecId);
+
+			Restart();
+		}
+
+	private:
+		void Restart()
+		{
+			FrequencyCache.Reset();
+			FrequencyCache.Update(*Frequency);
+			UpdateFrequency();
+
+			Phase.Reset(Time->GetSeconds(), ClampedFrequency);
+
+			if constexpr (bIsAudio)
+			{
+				// With no previous block to go by, Time is assumed to run at the graph's rate.
+				SetOscillatorStep(UE_DOUBLE_TWO_PI * ClampedFrequency / static_cast<double>(SampleRate));
+				Generate();
+			}
+			else
+			{
+				*OutputValue = EvaluateValue();
+			}
+		}
+
+		void UpdateFrequency()
+		{
+			ClampedFrequency = static_cast<double>(*Frequency);
+
+			if constexpr (bIsAudio)
+			{
+				const double Nyquist = 0.5 * static_cast<double>(SampleRate);
+				ClampedFrequency = FMath::Clamp(ClampedFrequency, -Nyquist, Nyquist);
+			}
+		}
+
+		/** Runs the oscillator at the rate the phase moved over the last block, so the block ends where the next one
+		 *  starts as long as Time keeps that rate, and the output holds while Time stands still. A step beyond Nyquist
+		 *  means Time jumped rather than played, so that block runs at the frequency alone. */
+		void UpdateStep()
+		{
+			const double NumFrames = static_cast<double>(FMath::Max(OutputValue->Num(), 1));
+			double Step = UE_DOUBLE_TWO_PI * ClampedFrequency * Phase.GetElapsedSeconds() / NumFrames;
+			if (FMath::Abs(Step) > UE_DOUBLE_PI)
+			{
+				Step = UE_DOUBLE_TWO_PI * ClampedFrequency / static_cast<double>(SampleRate);
+			}
+
+			SetOscillatorStep(Step);
+		}
+
+		/** Rebuilding the rotation costs eight trig calls, so a Time input moving at a steady rate only pays for it once.
+		 *  Block times come from an accumulated clock, so the step derived from them wobbles in its last bits from block
+		 *  to block. Changes that small are ignored: over a block they move the phase by well under a float ulp, and
+		 *  the next block starts from the exact phase again. */
+		void SetOscillatorStep(double InStep)
+		{
+			constexpr double RelativeStepTolerance = 1.0e-12;
+			if (FMath::Abs(InStep - OscillatorStep) > RelativeStepTolerance * FMath::Abs(InStep))
+			{
+				OscillatorStep = InStep;
+				Oscillator.SetStep(InStep);
+			}
+		}
+
+		float EvaluateValue() const
+		{
+			return static_cast<float>(FMath::Sin(Phase.GetRadians()));
+		}
+
+		/** Starts the oscillator on the block's phase, which also discards the float drift of the previous block. */
+		void Generate()
+		{
+			Oscillator.SetPhase(Phase.GetRadians());
+			Oscillator.Generate(TArrayView<float>(OutputValue->GetData(), OutputValue->Num()));
+		}
+
+		FTimeReadRef Time;
+		FFloatReadRef Frequency;
+		TDataWriteReference<OutputType> OutputValue;
+
+		TInputCache<float> FrequencyCache;
+		ExtensionsNodeStats::FNodeClassStats& NodeClassStats;
+
+		ExtensionsMath::FTimePhase Phase;
+		double ClampedFrequency = 0.0;
+		float SampleRate = 48000.0f;
+
+		// Audio output only.
+		ExtensionsMath::FRotationOscillator Oscillator;
+		double OscillatorStep = 0.0;
+
+		bool bIsConstantTime = false;
+		bool bIsConstantFrequency = false;
+	};
+
+	/** TTimeSineNode
+	 *
+	 *  Returns sin(2 * PI * Frequency * Time) with a double precision phase.
+	 */
+	template <typename OutputType>
+	using TTimeSineNode = TNodeFacade<TTimeSineNodeOperator<OutputType>>;
+
+	using FTimeSineNodeFloat = TTimeSineNode<float>;
+	METASOUND_REGISTER_NODE(FTimeSineNodeFloat)
+
+	using FTimeSineNodeAudioBuffer = TTimeSineNode<FAudioBuffer>;
+	METASOUND_REGISTER_NODE(FTimeSineNodeAudioBuffer)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,58 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsUnaryMathNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_UnwindDegreesNode"
+
+namespace Metasound
+{
+	namespace MetasoundUnwindDegreesNodePrivate
+	{
+		struct FUnwindDegreesPolicy
+		{
+			static constexpr const TCHAR* Name = TEXT("UnwindDegrees");
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = false;
+
+			static FText GetDisplayName(const FText& InDataTypeDisplayText)
+			{
+				return METASOUND_LOCTEXT_FORMAT("UnwindDegreesDisplayNamePattern", "UnwindDegrees ({0})", InDataTypeDisplayText);
+			}
+
+			static FText GetDescription()
+			{
+				return METASOUND_LOCTEXT("UnwindDegreesDesc", "Returns the angle in degrees unwound to the range -180 to 180.");
+			}
+
+			static FText GetOutputDescription()
+			{
+				return METASOUND_LOCTEXT("OutputValueTooltip", "The unwound degrees value.");
+			}
+
+			static int32 EvaluateInt32(const int32 In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return ExtensionsMath::UnwindIntegerDegrees(In);
+			}
+
+			static float EvaluateFloat(const float In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return ExtensionsMath::UnwindDegrees(In);
+			}
+
+			static double EvaluateDouble(const double In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return ExtensionsMath::UnwindDegrees(In);
+			}
+
+			static void EvaluateBlock(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				ExtensionsMath::ArrayUnwindDegrees(InValues, OutValues);
+			}
+		};
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
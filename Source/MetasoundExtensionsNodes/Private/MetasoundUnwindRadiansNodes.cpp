@@ -0,0 +1,65 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundUnwindRadiansNodes.h"
+
+#include "MetasoundExtensionsTriggeredUnaryMathNode.h"
+#include "MetasoundNodeRegistrationMacro.h"
+
+namespace Metasound
+{
+	/** TUnwindRadiansNode
+	 *
+	 *  Returns the angle in radians unwound to the range -PI to PI.
+	 */
+	template <typename ValueType>
+	using TUnwindRadiansNode = TUnaryMathNode<MetasoundUnwindRadiansNodePrivate::FUnwindRadiansPolicy, ValueType>;
+
+	using FUnwindRadiansNodeInt32 = TUnwindRadiansNode<int32>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeInt32)
+
+	using FUnwindRadiansNodeFloat = TUnwindRadiansNode<float>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeFloat)
+
+	using FUnwindRadiansNodeTime = TUnwindRadiansNode<FTime>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeTime)
+
+	using FUnwindRadiansNodeAudioBuffer = TUnwindRadiansNode<FAudioBuffer>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeAudioBuffer)
+
+	using FUnwindRadiansNodeInt32Array = TUnwindRadiansNode<TArray<int32>>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeInt32Array)
+
+	using FUnwindRadiansNodeFloatArray = TUnwindRadiansNode<TArray<float>>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeFloatArray)
+
+	using FUnwindRadiansNodeTimeArray = TUnwindRadiansNode<TArray<FTime>>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansNodeTimeArray)
+
+	/** TUnwindRadiansSampleAndHoldNode
+	 *
+	 *  Returns the unwound angle of the input value when triggered and holds it until the next trigger.
+	 */
+	template <typename ValueType>
+	using TUnwindRadiansSampleAndHoldNode = TTriggeredUnaryMathNode<MetasoundUnwindRadiansNodePrivate::FUnwindRadiansPolicy, ValueType>;
+
+	using FUnwindRadiansSampleAndHoldNodeInt32 = TUnwindRadiansSampleAndHoldNode<int32>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansSampleAndHoldNodeInt32)
+
+	using FUnwindRadiansSampleAndHoldNodeFloat = TUnwindRadiansSampleAndHoldNode<float>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansSampleAndHoldNodeFloat)
+
+	using FUnwindRadiansSampleAndHoldNodeTime = TUnwindRadiansSampleAndHoldNode<FTime>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansSampleAndHoldNodeTime)
+
+	using FUnwindRadiansSampleAndHoldNodeAudioBuffer = TUnwindRadiansSampleAndHoldNode<FAudioBuffer>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansSampleAndHoldNodeAudioBuffer)
+
+	using FUnwindRadiansSampleAndHoldNodeInt32Array = TUnwindRadiansSampleAndHoldNode<TArray<int32>>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansSampleAndHoldNodeInt32Array)
+
+	using FUnwindRadiansSampleAndHoldNodeFloatArray = TUnwindRadiansSampleAndHoldNode<TArray<float>>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansSampleAndHoldNodeFloatArray)
+
+	using FUnwindRadiansSampleAndHoldNodeTimeArray = TUnwindRadiansSampleAndHoldNode<TArray<FTime>>;
+	METASOUND_REGISTER_NODE(FUnwindRadiansSampleAndHoldNodeTimeArray)
+}
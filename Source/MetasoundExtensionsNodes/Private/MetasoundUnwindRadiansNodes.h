@@ -0,0 +1,58 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundExtensionsUnaryMathNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_UnwindRadiansNode"
+
+namespace Metasound
+{
+	namespace MetasoundUnwindRadiansNodePrivate
+	{
+		struct FUnwindRadiansPolicy
+		{
+			static constexpr const TCHAR* Name = TEXT("UnwindRadians");
+			static constexpr int32 MajorVersion = 1;
+			static constexpr int32 MinorVersion = 0;
+			static constexpr bool bHasPrecision = false;
+
+			static FText GetDisplayName(const FText& InDataTypeDisplayText)
+			{
+				return METASOUND_LOCTEXT_FORMAT("UnwindRadiansDisplayNamePattern", "UnwindRadians ({0})", InDataTypeDisplayText);
+			}
+
+			static FText GetDescription()
+			{
+				return METASOUND_LOCTEXT("UnwindRadiansDesc", "Returns the angle in radians unwound to the range -PI to PI.");
+			}
+
+			static FText GetOutputDescription()
+			{
+				return METASOUND_LOCTEXT("OutputValueTooltip", "The unwound radians value.");
+			}
+
+			static int32 EvaluateInt32(const int32 In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return static_cast<int32>(ExtensionsMath::UnwindRadians(static_cast<float>(In)));
+			}
+
+			static float EvaluateFloat(const float In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return ExtensionsMath::UnwindRadians(In);
+			}
+
+			static double EvaluateDouble(const double In, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				return ExtensionsMath::UnwindRadians(In);
+			}
+
+			static void EvaluateBlock(TArrayView<const float> InValues, TArrayView<float> OutValues, const ExtensionsMath::FSinKernel& InKernel)
+			{
+				ExtensionsMath::ArrayUnwindRadians(InValues, OutValues);
+			}
+		};
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,1323 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "Math/UnrealMathUtility.h"
+#include "MetasoundDegSinCosNodes.h"
+#include "MetasoundDegSinNodes.h"
+#include "MetasoundDegreesToRadiansNodes.h"
+#include "MetasoundExtensionsDecimation.h"
+#include "MetasoundExtensionsMath.h"
+#include "MetasoundExtensionsSineTable.h"
+#include "MetasoundRadiansToDegreesNodes.h"
+#include "MetasoundSinCosNodes.h"
+#include "MetasoundSinNodes.h"
+#include "MetasoundUnwindDegreesNodes.h"
+#include "MetasoundUnwindRadiansNodes.h"
+#include "Misc/AutomationTest.h"
+#include "Templates/Function.h"
+
+#include <cmath>
+#include <limits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Accuracy tests
+ *
+ *  Sweep every node path (int32, float, time and audio, for each precision mode) over dense ranges and adversarial
+ *  inputs: huge angles, signed zero, denormals, NaN, infinities and int32 extremes. Each path is evaluated through the
+ *  policy its nodes are built from, compared against a double precision reference and held to the error budget
+ *  documented for its precision mode. The block paths repeat for every vector tier the machine supports, and for the
+ *  ISPC kernels when built. They run headless, so they can gate a build:
+ *
+ *  UnrealEditor-Cmd <Project> -ExecCmds="Automation RunTests Audio.MetasoundExtensions.Accuracy; Quit" -unattended -nullrhi
+ */
+namespace MetasoundExtensionsAccuracyTestPrivate
+{
+	using namespace Metasound;
+	using namespace Metasound::ExtensionsMath;
+
+	// Relative rounding error of a single float operation, 2^-24.
+	constexpr double FloatRoundingError = 5.9604644775390625e-8;
+
+	// One ulp of a float in [1, 2), the absolute error of one ulp at the peak of a sine.
+	constexpr double FloatUlpAtOne = 1.1920928955078125e-7;
+
+	constexpr double Unbounded = std::numeric_limits<double>::infinity();
+	constexpr double DegreesPerRadian = 180.0 / UE_DOUBLE_PI;
+	constexpr double RadiansPerDegree = UE_DOUBLE_PI / 180.0;
+
+	// Range over which the trig error budgets are documented, see ETrigPrecision.
+	constexpr double TrigDomain = 8192.0;
+
+	// Largest magnitude below which every integer is a float.
+	constexpr double FloatIntegerLimit = 16777216.0;
+
+	constexpr int32 DenseIntegerLimit = 100000;
+	constexpr int32 MaxReportedFailures = 5;
+
+	/** Error allowed for one node path.
+	 *
+	 *  Inputs within DomainLimit are held to the error budget. Inputs beyond it only have to stay finite and inside the
+	 *  output range, when the range is bounded. NaN input must give NaN, and infinite input must not give a finite value.
+	 */
+	struct FBudget
+	{
+		double MaxAbsoluteError = 0.0;
+
+		// Added per unit of |input|, for paths that round a scaled argument before evaluating it.
+		double MaxAbsoluteErrorPerInputUnit = 0.0;
+
+		// When non-zero, outputs are held to this many float ulps of the reference instead of an absolute error.
+		double MaxUlpError = 0.0;
+
+		// When non-zero, errors are measured modulo this period, so either end of a wrapped range matches.
+		double Period = 0.0;
+
+		double DomainLimit = Unbounded;
+
+		double MinValue = -1.0;
+		double MaxValue = 1.0;
+		double RangeTolerance = 0.0;
+		double RangeTolerancePerInputUnit = 0.0;
+
+		// The node truncates the value to int32; any truncation of a value within the error budget is accepted.
+		bool bTruncated = false;
+	};
+
+	/** Budgets for the sine of an angle in radians, matching the table on ETrigPrecision. */
+	FBudget GetTrigBudget(ETrigPrecision InPrecision, bool bInSinCos)
+	{
+		// Interpolation error depends on the spacing of the shared table, so the budget follows its configured size.
+		const double TableStep = UE_DOUBLE_TWO_PI / static_cast<double>(FMath::Max(GetSineTableSize(), 1));
+
+		FBudget Budget;
+		Budget.DomainLimit = TrigDomain;
+
+		switch (InPrecision)
+		{
+			case ETrigPrecision::Fast:
+				Budget.MaxAbsoluteError = bInSinCos ? 1.3e-5 : 7.0e-5;
+				break;
+
+			case ETrigPrecision::Balanced:
+				Budget.MaxAbsoluteError = 2.0e-7;
+				break;
+
+			case ETrigPrecision::TableLinear:
+				Budget.MaxAbsoluteError = TableStep * TableStep / 8.0 + 3.0e-7;
+				break;
+
+			case ETrigPrecision::TableCubic:
+				Budget.MaxAbsoluteError = 0.02 * TableStep * TableStep * TableStep + 6.0e-7;
+				break;
+
+			case ETrigPrecision::Exact:
+			default:
+				Budget.MaxUlpError = 1.0;
+				Budget.DomainLimit = Unbounded;
+				break;
+		}
+
+		return Budget;
+	}
+
+	/** Adapts a budget to the degree paths, which reduce the input exactly in degrees and only convert the reduced
+	 *  angle, at most InMaxReducedRadians, to radians. The budget holds for every input magnitude. Paths that round
+	 *  the argument to float move it by up to 2^-23 of the reduced angle (PI / 180 is rounded too), which turns an ulp
+	 *  budget into an absolute one. */
+	FBudget ForReducedDegrees(const FBudget& InBudget, double InMaxReducedRadians, bool bInFloatArgument)
+	{
+		FBudget Budget = InBudget;
+		Budget.DomainLimit = Unbounded;
+
+		if (bInFloatArgument)
+		{
+			if (InBudget.MaxUlpError > 0.0)
+			{
+				Budget.MaxAbsoluteError = InBudget.MaxUlpError * FloatUlpAtOne;
+				Budget.MaxUlpError = 0.0;
+			}
+
+			Budget.MaxAbsoluteError += 2.0 * FloatRoundingError * InMaxReducedRadians;
+		}
+
+		return Budget;
+	}
+
+	/** The int32 nodes truncate a float result, so they are held to the float budget across the truncation. */
+	FBudget ForTruncatedOutput(const FBudget& InBudget)
+	{
+		FBudget Budget = InBudget;
+		Budget.bTruncated = true;
+
+		if (InBudget.MaxUlpError > 0.0)
+		{
+			Budget.MaxAbsoluteError = InBudget.MaxUlpError * FloatUlpAtOne;
+			Budget.MaxUlpError = 0.0;
+		}
+
+		return Budget;
+	}
+
+	double GetUlpError(double InOutput, double InReference)
+	{
+		const float Rounded = FMath::Abs(static_cast<float>(InReference));
+		const double Ulp = static_cast<double>(std::nextafter(Rounded, std::numeric_limits<float>::infinity())) - static_cast<double>(Rounded);
+
+		return FMath::Abs(InOutput - InReference) / Ulp;
+	}
+
+	/** Sine of a whole number of degrees, exact at every multiple of 90. */
+	double SinIntegerDegreesReference(int64 InDegrees)
+	{
+		const int64 Wrapped = ((InDegrees % 360) + 360) % 360;
+		if (0 == (Wrapped % 180))
+		{
+			return 0.0;
+		}
+
+		if (90 == Wrapped || 270 == Wrapped)
+		{
+			return (90 == Wrapped) ? 1.0 : -1.0;
+		}
+
+		return FMath::Sin(static_cast<double>(Wrapped) * RadiansPerDegree);
+	}
+
+	/** Sine of an angle in degrees, reduced exactly before converting to radians. */
+	double SinDegreesReference(double InDegrees)
+	{
+		const double Wrapped = std::fmod(InDegrees, 360.0);
+		if (Wrapped == FMath::RoundToDouble(Wrapped))
+		{
+			return SinIntegerDegreesReference(static_cast<int64>(Wrapped));
+		}
+
+		return FMath::Sin(Wrapped * RadiansPerDegree);
+	}
+
+	/** Holds node outputs to their budgets on behalf of one automation test. */
+	class FAccuracyRunner
+	{
+	public:
+		explicit FAccuracyRunner(FAutomationTestBase& InTest)
+			: Test(InTest)
+		{
+		}
+
+		void SetKernelLabel(const FString& InLabel)
+		{
+			KernelLabel = InLabel;
+		}
+
+		/** Compares every output against the reference for its input and reports a path that exceeds its budget as a
+		 *  test error. Each check is prefixed with the label of the block kernels in use. */
+		void Check(const FString& InName, const FBudget& InBudget, TConstArrayView<double> InInputs, TConstArrayView<double> InOutputs, TFunctionRef<double(double)> InReference)
+		{
+			check(InInputs.Num() == InOutputs.Num());
+
+			const FString Name = KernelLabel.IsEmpty() ? InName : FString::Printf(TEXT("%s/%s"), *KernelLabel, *InName);
+
+			double MaxAbsoluteError = 0.0;
+			double MaxUlpError = 0.0;
+			double WorstInput = 0.0;
+			int32 NumFailures = 0;
+
+			for (int32 Index = 0; Index < InInputs.Num(); ++Index)
+			{
+				const double Input = InInputs[Index];
+				const double Output = InOutputs[Index];
+				double Reference = std::numeric_limits<double>::quiet_NaN();
+				bool bPassed = true;
+
+				if (FMath::IsNaN(Input))
+				{
+					bPassed = FMath::IsNaN(Output);
+				}
+				else if (!FMath::IsFinite(Input))
+				{
+					bPassed = !FMath::IsFinite(Output);
+				}
+				else
+				{
+					const bool bBoundedRange = FMath::IsFinite(InBudget.MaxValue - InBudget.MinValue);
+					const bool bInDomain = FMath::Abs(Input) <= InBudget.DomainLimit;
+					const double RangeSlack = InBudget.RangeTolerance + InBudget.RangeTolerancePerInputUnit * FMath::Abs(Input);
+
+					if (bBoundedRange || bInDomain)
+					{
+						bPassed = FMath::IsFinite(Output) && Output >= InBudget.MinValue - RangeSlack && Output <= InBudget.MaxValue + RangeSlack;
+					}
+
+					if (bPassed && bInDomain)
+					{
+						Reference = InReference(Input);
+
+						const double AllowedError = InBudget.MaxAbsoluteError + InBudget.MaxAbsoluteErrorPerInputUnit * FMath::Abs(Input);
+						double Error = Output - Reference;
+						if (InBudget.Period > 0.0)
+						{
+							Error = std::remainder(Error, InBudget.Period);
+						}
+
+						Error = FMath::Abs(Error);
+						if (Error > MaxAbsoluteError)
+						{
+							MaxAbsoluteError = Error;
+							WorstInput = Input;
+						}
+
+						if (InBudget.bTruncated)
+						{
+							bPassed = Output >= std::trunc(Reference - AllowedError) && Output <= std::trunc(Reference + AllowedError);
+						}
+						else if (InBudget.MaxUlpError > 0.0)
+						{
+							const double UlpError = GetUlpError(Output, Reference);
+							MaxUlpError = FMath::Max(MaxUlpError, UlpError);
+							bPassed = UlpError <= InBudget.MaxUlpError;
+						}
+						else
+						{
+							bPassed = Error <= AllowedError;
+						}
+					}
+				}
+
+				if (!bPassed)
+				{
+					++NumFailures;
+					if (NumFailures <= MaxReportedFailures)
+					{
+						Test.AddError(FString::Printf(TEXT("%s: input %.17g gave %.17g, reference %.17g"), *Name, Input, Output, Reference));
+					}
+				}
+			}
+
+			const double BudgetValue = (InBudget.MaxUlpError > 0.0) ? InBudget.MaxUlpError : InBudget.MaxAbsoluteError;
+			const TCHAR* BudgetUnit = (InBudget.MaxUlpError > 0.0) ? TEXT("ulp") : TEXT("abs");
+			const FString Summary = FString::Printf(TEXT("%s values %d, max abs %.3e, max ulp %.3f, worst input %.7g, budget %.3e %s, failures %d"),
+				*Name, InInputs.Num(), MaxAbsoluteError, MaxUlpError, WorstInput, BudgetValue, BudgetUnit, NumFailures);
+
+			if (0 == NumFailures)
+			{
+				Test.AddInfo(Summary);
+			}
+			else
+			{
+				Test.AddError(Summary);
+			}
+		}
+
+	private:
+		FAutomationTestBase& Test;
+		FString KernelLabel;
+	};
+
+	template <typename FunctionType>
+	TArray<double> EvaluateScalar(TConstArrayView<double> InInputs, FunctionType&& InFunction)
+	{
+		TArray<double> Outputs;
+		Outputs.SetNumUninitialized(InInputs.Num());
+
+		for (int32 Index = 0; Index < InInputs.Num(); ++Index)
+		{
+			Outputs[Index] = static_cast<double>(InFunction(InInputs[Index]));
+		}
+
+		return Outputs;
+	}
+
+	/** Runs a block kernel over the inputs in blocks of varying length, so the scalar tails are covered as well as the
+	 *  vector body. InFunction receives the offset of each block along with its input and output views. */
+	template <typename FunctionType>
+	TArray<double> EvaluateBlocks(TConstArrayView<double> InInputs, FunctionType&& InFunction)
+	{
+		constexpr int32 BlockSizes[] = {256, 509, 3, 1024, 1, 66};
+
+		const int32 Num = InInputs.Num();
+		TArray<float> Inputs;
+		TArray<float> Outputs;
+		Inputs.SetNumUninitialized(Num);
+		Outputs.SetNumZeroed(Num);
+
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Inputs[Index] = static_cast<float>(InInputs[Index]);
+		}
+
+		int32 BlockIndex = 0;
+		for (int32 Start = 0; Start < Num; ++BlockIndex)
+		{
+			const int32 BlockSize = FMath::Min(BlockSizes[BlockIndex % UE_ARRAY_COUNT(BlockSizes)], Num - Start);
+			InFunction(Start, MakeArrayView(Inputs.GetData() + Start, BlockSize), MakeArrayView(Outputs.GetData() + Start, BlockSize));
+			Start += BlockSize;
+		}
+
+		TArray<double> Result;
+		Result.SetNumUninitialized(Num);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Result[Index] = Outputs[Index];
+		}
+
+		return Result;
+	}
+
+	TArray<double> ToDouble(TConstArrayView<float> InValues)
+	{
+		TArray<double> Result;
+		Result.SetNumUninitialized(InValues.Num());
+		for (int32 Index = 0; Index < InValues.Num(); ++Index)
+		{
+			Result[Index] = InValues[Index];
+		}
+
+		return Result;
+	}
+
+	/** Angles where kernels tend to break: far beyond the documented domain, near quarter turns, signed zero,
+	 *  denormals and non-finite values. InUnitsPerRadian scales the angular ones into the input's unit. */
+	void AddAdversarialAngles(TArray<double>& OutInputs, double InUnitsPerRadian)
+	{
+		constexpr double HugeMagnitudes[] = {1.0e4, 65536.0, 1.0e5, 1.0e6, 1.0e7, 16777216.0, 1.0e8, 1.0e9, 1.0e10, 1.0e20, 1.0e30};
+		for (const double Magnitude : HugeMagnitudes)
+		{
+			const double Scaled = FMath::Min(Magnitude * InUnitsPerRadian, static_cast<double>(TNumericLimits<float>::Max()));
+			OutInputs.Add(static_cast<float>(Scaled));
+			OutInputs.Add(-static_cast<float>(Scaled));
+		}
+
+		OutInputs.Add(TNumericLimits<float>::Max());
+		OutInputs.Add(TNumericLimits<float>::Lowest());
+
+		for (int64 Quarter = 1; Quarter < (int64(1) << 26); Quarter = Quarter * 3 + 1)
+		{
+			const double Angle = static_cast<double>(Quarter) * UE_DOUBLE_HALF_PI * InUnitsPerRadian;
+			OutInputs.Add(static_cast<float>(Angle));
+			OutInputs.Add(-static_cast<float>(Angle));
+		}
+
+		OutInputs.Add(0.0);
+		OutInputs.Add(-0.0);
+		OutInputs.Add(std::numeric_limits<float>::denorm_min());
+		OutInputs.Add(-std::numeric_limits<float>::denorm_min());
+		OutInputs.Add(static_cast<float>(1.0e-40));
+		OutInputs.Add(static_cast<float>(-1.0e-40));
+		OutInputs.Add(TNumericLimits<float>::Min());
+		OutInputs.Add(-TNumericLimits<float>::Min());
+		OutInputs.Add(static_cast<float>(1.0e-30));
+
+		OutInputs.Add(std::numeric_limits<double>::quiet_NaN());
+		OutInputs.Add(std::numeric_limits<double>::infinity());
+		OutInputs.Add(-std::numeric_limits<double>::infinity());
+	}
+
+	/** Float angles covering the documented domain densely, with extra density within a turn of zero. */
+	TArray<double> MakeAngleInputs(double InUnitsPerRadian)
+	{
+		constexpr int32 NumDense = 1 << 21;
+		constexpr int32 NumNearZero = 1 << 20;
+
+		TArray<double> Inputs;
+		Inputs.Reserve(NumDense + NumNearZero + 256);
+
+		const double Limit = TrigDomain * InUnitsPerRadian;
+		for (int32 Index = 0; Index < NumDense; ++Index)
+		{
+			Inputs.Add(static_cast<float>(-Limit + 2.0 * Limit * static_cast<double>(Index) / static_cast<double>(NumDense - 1)));
+		}
+
+		const double NearLimit = UE_DOUBLE_TWO_PI * InUnitsPerRadian;
+		for (int32 Index = 0; Index < NumNearZero; ++Index)
+		{
+			Inputs.Add(static_cast<float>(-NearLimit + 2.0 * NearLimit * static_cast<double>(Index) / static_cast<double>(NumNearZero - 1)));
+		}
+
+		AddAdversarialAngles(Inputs, InUnitsPerRadian);
+		return Inputs;
+	}
+
+	/** Every integer in [-DenseIntegerLimit, DenseIntegerLimit] plus the int32 extremes and the float integer limit. */
+	TArray<double> MakeIntegerInputs()
+	{
+		TArray<double> Inputs;
+		Inputs.Reserve(2 * DenseIntegerLimit + 64);
+
+		for (int32 Value = -DenseIntegerLimit; Value <= DenseIntegerLimit; ++Value)
+		{
+			Inputs.Add(Value);
+		}
+
+		constexpr int32 MaxWholeTurns = MAX_int32 - (MAX_int32 % 360);
+		constexpr int32 Extremes[] = {MIN_int32, MIN_int32 + 1, MAX_int32, MAX_int32 - 1, MaxWholeTurns, MaxWholeTurns - 90, -MaxWholeTurns, -MaxWholeTurns + 90, 1 << 24, (1 << 24) + 1, -(1 << 24), -(1 << 24) - 1};
+		for (const int32 Value : Extremes)
+		{
+			Inputs.Add(Value);
+		}
+
+		return Inputs;
+	}
+
+	struct FAccuracyInputs
+	{
+		TArray<double> Radians = MakeAngleInputs(1.0);
+		TArray<double> Degrees = MakeAngleInputs(DegreesPerRadian);
+		TArray<double> Integers = MakeIntegerInputs();
+	};
+
+	/** Converts between the double precision test values and the node data types. */
+	template <typename ValueType>
+	struct TTestValue
+	{
+	};
+
+	template <>
+	struct TTestValue<int32>
+	{
+		static int32 FromDouble(double InValue)
+		{
+			return static_cast<int32>(InValue);
+		}
+
+		static double ToDouble(int32 InValue)
+		{
+			return InValue;
+		}
+	};
+
+	template <>
+	struct TTestValue<float>
+	{
+		static float FromDouble(double InValue)
+		{
+			return static_cast<float>(InValue);
+		}
+
+		static double ToDouble(float InValue)
+		{
+			return InValue;
+		}
+	};
+
+	template <>
+	struct TTestValue<FTime>
+	{
+		static FTime FromDouble(double InValue)
+		{
+			return FTime(InValue);
+		}
+
+		static double ToDouble(const FTime& InValue)
+		{
+			return InValue.GetSeconds();
+		}
+	};
+
+	/** Evaluates a unary math policy on every input the way its ValueType node does. */
+	template <typename PolicyType, typename ValueType>
+	TArray<double> EvaluateUnary(TConstArrayView<double> InInputs, const FSinKernel& InKernel)
+	{
+		return EvaluateScalar(InInputs, [&InKernel](double InX)
+		{
+			ValueType Output{};
+			UnaryMathNodePrivate::TUnaryMathValue<ValueType>::template Evaluate<PolicyType>(TTestValue<ValueType>::FromDouble(InX), Output, InKernel);
+			return TTestValue<ValueType>::ToDouble(Output);
+		});
+	}
+
+	/** Evaluates a unary math policy's block function, as its audio buffer node does. */
+	template <typename PolicyType>
+	TArray<double> EvaluateUnaryBlocks(TConstArrayView<double> InInputs, const FSinKernel& InKernel)
+	{
+		return EvaluateBlocks(InInputs, [&InKernel](int32 InStart, TArrayView<const float> In, TArrayView<float> Out)
+		{
+			PolicyType::EvaluateBlock(In, Out, InKernel);
+		});
+	}
+
+	struct FSinCosOutputs
+	{
+		TArray<double> Sin;
+		TArray<double> Cos;
+	};
+
+	/** Evaluates a SinCos policy on every input the way its ValueType node does. */
+	template <typename PolicyType, typename ValueType>
+	FSinCosOutputs EvaluateSinCos(TConstArrayView<double> InInputs, const FSinCosKernel& InKernel)
+	{
+		FSinCosOutputs Outputs;
+		Outputs.Sin.SetNumUninitialized(InInputs.Num());
+		Outputs.Cos.SetNumUninitialized(InInputs.Num());
+
+		for (int32 Index = 0; Index < InInputs.Num(); ++Index)
+		{
+			ValueType Sin{};
+			ValueType Cos{};
+			SinCosNodePrivate::TSinCosValue<ValueType>::template Evaluate<PolicyType>(TTestValue<ValueType>::FromDouble(InInputs[Index]), Sin, Cos, InKernel);
+
+			Outputs.Sin[Index] = TTestValue<ValueType>::ToDouble(Sin);
+			Outputs.Cos[Index] = TTestValue<ValueType>::ToDouble(Cos);
+		}
+
+		return Outputs;
+	}
+
+	/** Evaluates a SinCos policy's block function, as its audio buffer node does. */
+	template <typename PolicyType>
+	FSinCosOutputs EvaluateSinCosBlocks(TConstArrayView<double> InInputs, const FSinCosKernel& InKernel)
+	{
+		TArray<float> Cos;
+		Cos.SetNumZeroed(InInputs.Num());
+
+		FSinCosOutputs Outputs;
+		Outputs.Sin = EvaluateBlocks(InInputs, [&InKernel, &Cos](int32 InStart, TArrayView<const float> In, TArrayView<float> Out)
+		{
+			PolicyType::EvaluateBlock(In, Out, MakeArrayView(Cos.GetData() + InStart, Out.Num()), InKernel);
+		});
+		Outputs.Cos = ToDouble(Cos);
+
+		return Outputs;
+	}
+
+	/** Runs InFunction on every vector tier this machine supports, then on the ISPC kernels when they are built, since
+	 *  any of them may be picked at startup. The previous selection is restored afterwards. */
+	void ForEachBlockKernelSet(FAccuracyRunner& InRunner, TFunctionRef<void()> InFunction)
+	{
+		const EVectorTier PreviousTier = GetVectorTier();
+		const bool bWasUsingIspc = IsUsingIspcKernels();
+		SetUseIspcKernels(false);
+
+		for (const EVectorTier Tier : AllVectorTiers)
+		{
+			if (Tier > GetSupportedVectorTier())
+			{
+				continue;
+			}
+
+			SetVectorTier(Tier);
+			InRunner.SetKernelLabel(LexToString(Tier));
+			InFunction();
+		}
+
+		SetVectorTier(PreviousTier);
+
+		if (HasIspcKernels())
+		{
+			SetUseIspcKernels(true);
+			InRunner.SetKernelLabel(TEXT("ISPC"));
+			InFunction();
+		}
+
+		SetUseIspcKernels(bWasUsingIspc);
+		InRunner.SetKernelLabel(FString());
+	}
+
+	void CheckSinPaths(FAccuracyRunner& InRunner, ETrigPrecision InPrecision, const FAccuracyInputs& InInputs)
+	{
+		using MetasoundSinNodePrivate::FSinPolicy;
+		using MetasoundDegSinNodePrivate::FDegSinPolicy;
+
+		const FSinKernel& Kernel = GetSinKernel(InPrecision);
+		const FBudget Budget = GetTrigBudget(InPrecision, false);
+		const FString Precision = LexToString(InPrecision);
+
+		// Only Exact evaluates the folded angle in double; the other kernels and the block path round it to float.
+		const FBudget DegreeBudget = ForReducedDegrees(Budget, UE_DOUBLE_HALF_PI, ETrigPrecision::Exact != InPrecision);
+		const FBudget AudioDegreeBudget = ForReducedDegrees(Budget, UE_DOUBLE_HALF_PI, true);
+
+		auto SinReference = [](double InX) { return FMath::Sin(InX); };
+
+		// The int32 nodes convert to float before evaluating, so the reference does too.
+		auto TruncatedSinReference = [](double InX) { return FMath::Sin(static_cast<double>(static_cast<float>(InX))); };
+
+		InRunner.Check(FString::Printf(TEXT("Sin/%s/int32"), *Precision), ForTruncatedOutput(Budget), InInputs.Integers, EvaluateUnary<FSinPolicy, int32>(InInputs.Integers, Kernel), TruncatedSinReference);
+		InRunner.Check(FString::Printf(TEXT("Sin/%s/float"), *Precision), Budget, InInputs.Radians, EvaluateUnary<FSinPolicy, float>(InInputs.Radians, Kernel), SinReference);
+		InRunner.Check(FString::Printf(TEXT("Sin/%s/Time"), *Precision), Budget, InInputs.Radians, EvaluateUnary<FSinPolicy, FTime>(InInputs.Radians, Kernel), SinReference);
+		InRunner.Check(FString::Printf(TEXT("Sin/%s/Audio"), *Precision), Budget, InInputs.Radians, EvaluateUnaryBlocks<FSinPolicy>(InInputs.Radians, Kernel), SinReference);
+
+		InRunner.Check(FString::Printf(TEXT("DegSin/%s/float"), *Precision), DegreeBudget, InInputs.Degrees, EvaluateUnary<FDegSinPolicy, float>(InInputs.Degrees, Kernel), SinDegreesReference);
+		InRunner.Check(FString::Printf(TEXT("DegSin/%s/Time"), *Precision), DegreeBudget, InInputs.Degrees, EvaluateUnary<FDegSinPolicy, FTime>(InInputs.Degrees, Kernel), SinDegreesReference);
+		InRunner.Check(FString::Printf(TEXT("DegSin/%s/Audio"), *Precision), AudioDegreeBudget, InInputs.Degrees, EvaluateUnaryBlocks<FDegSinPolicy>(InInputs.Degrees, Kernel), SinDegreesReference);
+	}
+
+	/** Block sine that hands its input back unchanged, so ArraySinDegrees returns the folded angles themselves. */
+	void ArraySinPassThrough(TArrayView<const float> InValues, TArrayView<float> OutValues, float InScale)
+	{
+		FMemory::Memmove(OutValues.GetData(), InValues.GetData(), InValues.Num() * sizeof(float));
+	}
+
+	/** The vectorized fold in ArraySinDegrees is only used below 2^24, where it must match FoldSineDegrees bit for bit.
+	 *  The error budgets alone would not notice a fold that lands on a neighbouring float. */
+	void CheckSineDegreeFold(FAutomationTestBase& InTest, const FAccuracyInputs& InInputs)
+	{
+		const FSinKernel PassThroughKernel{nullptr, nullptr, &ArraySinPassThrough};
+
+		TArray<double> Inputs;
+		for (const double Input : InInputs.Degrees)
+		{
+			if (FMath::Abs(Input) <= FloatIntegerLimit)
+			{
+				Inputs.Add(Input);
+			}
+		}
+
+		// Quarter turns at every magnitude up to 2^24 and their float neighbours, where the unwind and the reflection
+		// change branch.
+		for (double Magnitude = 90.0; Magnitude <= FloatIntegerLimit; Magnitude *= 1.5)
+		{
+			const float QuarterTurn = static_cast<float>(90.0 * FMath::RoundToDouble(Magnitude / 90.0));
+			const float Values[] = {QuarterTurn, std::nextafter(QuarterTurn, 0.0f), std::nextafter(QuarterTurn, TNumericLimits<float>::Max())};
+			for (const float Value : Values)
+			{
+				Inputs.Add(Value);
+				Inputs.Add(-Value);
+			}
+		}
+
+		Inputs.Add(FloatIntegerLimit);
+		Inputs.Add(-FloatIntegerLimit);
+
+		const TArray<double> Folded = EvaluateBlocks(Inputs, [&PassThroughKernel](int32 InStart, TArrayView<const float> In, TArrayView<float> Out)
+		{
+			ArraySinDegrees(In, Out, PassThroughKernel);
+		});
+
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < Inputs.Num(); ++Index)
+		{
+			const float Expected = static_cast<float>(FoldSineDegrees(Inputs[Index]));
+			const float Actual = static_cast<float>(Folded[Index]);
+			if (0 != FMemory::Memcmp(&Expected, &Actual, sizeof(float)))
+			{
+				++NumMismatches;
+				if (NumMismatches <= MaxReportedFailures)
+				{
+					InTest.AddError(FString::Printf(TEXT("ArraySinDegrees fold: input %.9g gave %.9g, FoldSineDegrees %.9g"), Inputs[Index], Actual, Expected));
+				}
+			}
+		}
+
+		InTest.TestEqual(FString::Printf(TEXT("ArraySinDegrees fold mismatches over %d inputs"), Inputs.Num()), NumMismatches, 0);
+	}
+
+	/** Checks the sine and cosine outputs of one SinCos node path. */
+	void CheckSinCosOutputs(FAccuracyRunner& InRunner, const FString& InName, const FBudget& InBudget, const TArray<double>& InInputs, bool bInDegrees, const FSinCosOutputs& InOutputs)
+	{
+		if (bInDegrees)
+		{
+			InRunner.Check(InName + TEXT(".Sin"), InBudget, InInputs, InOutputs.Sin, SinDegreesReference);
+			InRunner.Check(InName + TEXT(".Cos"), InBudget, InInputs, InOutputs.Cos, [](double InX) { return SinDegreesReference(std::fmod(InX, 360.0) + 90.0); });
+		}
+		else
+		{
+			InRunner.Check(InName + TEXT(".Sin"), InBudget, InInputs, InOutputs.Sin, [](double InX) { return FMath::Sin(InX); });
+			InRunner.Check(InName + TEXT(".Cos"), InBudget, InInputs, InOutputs.Cos, [](double InX) { return FMath::Cos(InX); });
+		}
+	}
+
+	void CheckSinCosPaths(FAccuracyRunner& InRunner, ETrigPrecision InPrecision, const FAccuracyInputs& InInputs)
+	{
+		using MetasoundSinCosNodePrivate::FSinCosPolicy;
+		using MetasoundDegSinCosNodePrivate::FDegSinCosPolicy;
+
+		const FSinCosKernel& Kernel = GetSinCosKernel(InPrecision);
+		const FBudget Budget = GetTrigBudget(InPrecision, true);
+		const FString Precision = LexToString(InPrecision);
+
+		// The degree paths reduce to a quarter turn around the nearest multiple of 90 degrees; see CheckSinPaths.
+		const FBudget DegreeBudget = ForReducedDegrees(Budget, 0.5 * UE_DOUBLE_HALF_PI, ETrigPrecision::Exact != InPrecision);
+		const FBudget AudioDegreeBudget = ForReducedDegrees(Budget, 0.5 * UE_DOUBLE_HALF_PI, true);
+
+		CheckSinCosOutputs(InRunner, FString::Printf(TEXT("SinCos/%s/float"), *Precision), Budget, InInputs.Radians, false, EvaluateSinCos<FSinCosPolicy, float>(InInputs.Radians, Kernel));
+		CheckSinCosOutputs(InRunner, FString::Printf(TEXT("SinCos/%s/Time"), *Precision), Budget, InInputs.Radians, false, EvaluateSinCos<FSinCosPolicy, FTime>(InInputs.Radians, Kernel));
+		CheckSinCosOutputs(InRunner, FString::Printf(TEXT("SinCos/%s/Audio"), *Precision), Budget, InInputs.Radians, false, EvaluateSinCosBlocks<FSinCosPolicy>(InInputs.Radians, Kernel));
+
+		CheckSinCosOutputs(InRunner, FString::Printf(TEXT("DegSinCos/%s/float"), *Precision), DegreeBudget, InInputs.Degrees, true, EvaluateSinCos<FDegSinCosPolicy, float>(InInputs.Degrees, Kernel));
+		CheckSinCosOutputs(InRunner, FString::Printf(TEXT("DegSinCos/%s/Time"), *Precision), DegreeBudget, InInputs.Degrees, true, EvaluateSinCos<FDegSinCosPolicy, FTime>(InInputs.Degrees, Kernel));
+		CheckSinCosOutputs(InRunner, FString::Printf(TEXT("DegSinCos/%s/Audio"), *Precision), AudioDegreeBudget, InInputs.Degrees, true, EvaluateSinCosBlocks<FDegSinCosPolicy>(InInputs.Degrees, Kernel));
+	}
+
+	/** The int32 degree nodes read the integer table in every precision mode. The table values are held to 1 ulp, and
+	 *  the node outputs to any truncation of a value within that. */
+	void CheckIntegerDegreePaths(FAccuracyRunner& InRunner, const FAccuracyInputs& InInputs)
+	{
+		using MetasoundDegSinNodePrivate::FDegSinPolicy;
+		using MetasoundDegSinCosNodePrivate::FDegSinCosPolicy;
+
+		FBudget ValueBudget;
+		ValueBudget.MaxUlpError = 1.0;
+
+		const FBudget TruncatedBudget = ForTruncatedOutput(ValueBudget);
+
+		auto SinReference = [](double InX) { return SinIntegerDegreesReference(static_cast<int64>(InX)); };
+		auto CosReference = [](double InX) { return SinIntegerDegreesReference(static_cast<int64>(InX) + 90); };
+
+		InRunner.Check(TEXT("DegSin/int32.Value"), ValueBudget, InInputs.Integers, EvaluateScalar(InInputs.Integers, [](double InX) { return SinIntegerDegrees(static_cast<int32>(InX)); }), SinReference);
+		InRunner.Check(TEXT("DegSin/int32"), TruncatedBudget, InInputs.Integers, EvaluateUnary<FDegSinPolicy, int32>(InInputs.Integers, GetSinKernel(ETrigPrecision::Exact)), SinReference);
+
+		TArray<double> Sin;
+		TArray<double> Cos;
+		for (const double Input : InInputs.Integers)
+		{
+			float SinValue = 0.0f;
+			float CosValue = 0.0f;
+			SinCosIntegerDegrees(static_cast<int32>(Input), SinValue, CosValue);
+			Sin.Add(SinValue);
+			Cos.Add(CosValue);
+		}
+
+		InRunner.Check(TEXT("DegSinCos/int32.Value.Sin"), ValueBudget, InInputs.Integers, Sin, SinReference);
+		InRunner.Check(TEXT("DegSinCos/int32.Value.Cos"), ValueBudget, InInputs.Integers, Cos, CosReference);
+
+		const FSinCosOutputs Truncated = EvaluateSinCos<FDegSinCosPolicy, int32>(InInputs.Integers, GetSinCosKernel(ETrigPrecision::Exact));
+		InRunner.Check(TEXT("DegSinCos/int32.Sin"), TruncatedBudget, InInputs.Integers, Truncated.Sin, SinReference);
+		InRunner.Check(TEXT("DegSinCos/int32.Cos"), TruncatedBudget, InInputs.Integers, Truncated.Cos, CosReference);
+	}
+
+	/** The zero crossings of the integer table must be +0, since the error budgets cannot see the sign of a zero. */
+	void CheckIntegerDegreeZeroSigns(FAutomationTestBase& InTest)
+	{
+		constexpr int32 SineZeros[] = {0, 180, 360, -180, -360};
+		for (const int32 Degrees : SineZeros)
+		{
+			float Sin = 0.0f;
+			float Cos = 0.0f;
+			SinCosIntegerDegrees(Degrees, Sin, Cos);
+
+			InTest.TestFalse(FString::Printf(TEXT("SinIntegerDegrees(%d) is -0"), Degrees), std::signbit(SinIntegerDegrees(Degrees)));
+			InTest.TestFalse(FString::Printf(TEXT("SinCosIntegerDegrees(%d) sine is -0"), Degrees), std::signbit(Sin));
+		}
+
+		constexpr int32 CosineZeros[] = {90, 270, -90, -270};
+		for (const int32 Degrees : CosineZeros)
+		{
+			float Sin = 0.0f;
+			float Cos = 0.0f;
+			SinCosIntegerDegrees(Degrees, Sin, Cos);
+
+			InTest.TestFalse(FString::Printf(TEXT("SinCosIntegerDegrees(%d) cosine is -0"), Degrees), std::signbit(Cos));
+		}
+	}
+
+	void CheckUnwindPaths(FAccuracyRunner& InRunner, const FAccuracyInputs& InInputs)
+	{
+		using MetasoundUnwindDegreesNodePrivate::FUnwindDegreesPolicy;
+		using MetasoundUnwindRadiansNodePrivate::FUnwindRadiansPolicy;
+
+		// Nodes without a Precision input are given the Exact kernel, which the unwind policies ignore.
+		const FSinKernel& Kernel = GetSinKernel(ETrigPrecision::Exact);
+
+		auto Identity = [](double InX) { return InX; };
+
+		// Control-rate paths use an exact remainder, so any error at all is a failure.
+		FBudget Degrees;
+		Degrees.Period = 360.0;
+		Degrees.MinValue = -180.0;
+		Degrees.MaxValue = 180.0;
+
+		FBudget AudioDegrees = Degrees;
+		AudioDegrees.DomainLimit = FloatIntegerLimit;
+		AudioDegrees.RangeTolerancePerInputUnit = 2.0 * FloatRoundingError;
+
+		InRunner.Check(TEXT("UnwindDegrees/int32"), Degrees, InInputs.Integers, EvaluateUnary<FUnwindDegreesPolicy, int32>(InInputs.Integers, Kernel), Identity);
+		InRunner.Check(TEXT("UnwindDegrees/float"), Degrees, InInputs.Degrees, EvaluateUnary<FUnwindDegreesPolicy, float>(InInputs.Degrees, Kernel), Identity);
+		InRunner.Check(TEXT("UnwindDegrees/Time"), Degrees, InInputs.Degrees, EvaluateUnary<FUnwindDegreesPolicy, FTime>(InInputs.Degrees, Kernel), Identity);
+		InRunner.Check(TEXT("UnwindDegrees/Audio"), AudioDegrees, InInputs.Degrees, EvaluateUnaryBlocks<FUnwindDegreesPolicy>(InInputs.Degrees, Kernel), Identity);
+
+		// Float results are rounded from a double precision remainder, within half an ulp of PI.
+		FBudget Radians;
+		Radians.Period = UE_DOUBLE_TWO_PI;
+		Radians.MinValue = -UE_DOUBLE_PI;
+		Radians.MaxValue = UE_DOUBLE_PI;
+		Radians.MaxAbsoluteError = 1.3e-7;
+		Radians.RangeTolerance = 2.0 * UE_DOUBLE_PI * FloatRoundingError;
+		Radians.DomainLimit = FloatIntegerLimit;
+
+		FBudget TimeRadians = Radians;
+		TimeRadians.MaxAbsoluteError = 1.0e-9;
+		TimeRadians.RangeTolerance = 0.0;
+
+		FBudget AudioRadians = Radians;
+		AudioRadians.MaxAbsoluteError = 2.5e-7;
+		AudioRadians.DomainLimit = TrigDomain;
+		AudioRadians.RangeTolerancePerInputUnit = 2.0 * FloatRoundingError;
+
+		FBudget IntegerRadians = Radians;
+		IntegerRadians.Period = 0.0;
+		IntegerRadians.bTruncated = true;
+
+		InRunner.Check(TEXT("UnwindRadians/int32"), IntegerRadians, InInputs.Integers, EvaluateUnary<FUnwindRadiansPolicy, int32>(InInputs.Integers, Kernel), [](double InX) { return UnwindRadians(InX); });
+		InRunner.Check(TEXT("UnwindRadians/float"), Radians, InInputs.Radians, EvaluateUnary<FUnwindRadiansPolicy, float>(InInputs.Radians, Kernel), Identity);
+		InRunner.Check(TEXT("UnwindRadians/Time"), TimeRadians, InInputs.Radians, EvaluateUnary<FUnwindRadiansPolicy, FTime>(InInputs.Radians, Kernel), Identity);
+		InRunner.Check(TEXT("UnwindRadians/Audio"), AudioRadians, InInputs.Radians, EvaluateUnaryBlocks<FUnwindRadiansPolicy>(InInputs.Radians, Kernel), Identity);
+	}
+
+	/** Checks the node paths of one unit conversion, which multiplies its input by InScale. */
+	template <typename PolicyType>
+	void CheckConversionPaths(FAccuracyRunner& InRunner, const TCHAR* InName, const TArray<double>& InInputs, const TArray<double>& InIntegers, double InScale)
+	{
+		const FSinKernel& Kernel = GetSinKernel(ETrigPrecision::Exact);
+		auto Reference = [InScale](double InX) { return InX * InScale; };
+
+		// One rounding of the scale constant and one of the product. The range is unbounded, and the domain stops short of
+		// the magnitudes where the product overflows.
+		FBudget Budget;
+		Budget.MinValue = -Unbounded;
+		Budget.MaxValue = Unbounded;
+		Budget.DomainLimit = 1.0e30;
+		Budget.MaxAbsoluteErrorPerInputUnit = 2.0 * FloatRoundingError * InScale;
+
+		FBudget TimeBudget = Budget;
+		TimeBudget.MaxAbsoluteErrorPerInputUnit = 1.0e-15 * InScale;
+
+		// Products beyond the int32 range have no defined truncation.
+		FBudget Int32Budget = ForTruncatedOutput(Budget);
+		Int32Budget.DomainLimit = static_cast<double>(MAX_int32) / FMath::Max(InScale, 1.0);
+
+		InRunner.Check(FString::Printf(TEXT("%s/int32"), InName), Int32Budget, InIntegers, EvaluateUnary<PolicyType, int32>(InIntegers, Kernel), [InScale](double InX)
+		{
+			return static_cast<double>(static_cast<float>(InX)) * InScale;
+		});
+
+		InRunner.Check(FString::Printf(TEXT("%s/float"), InName), Budget, InInputs, EvaluateUnary<PolicyType, float>(InInputs, Kernel), Reference);
+		InRunner.Check(FString::Printf(TEXT("%s/Time"), InName), TimeBudget, InInputs, EvaluateUnary<PolicyType, FTime>(InInputs, Kernel), Reference);
+		InRunner.Check(FString::Printf(TEXT("%s/Audio"), InName), Budget, InInputs, EvaluateUnaryBlocks<PolicyType>(InInputs, Kernel), Reference);
+	}
+
+	// Precision the decimated sine nodes default to, for the evaluated frames.
+	constexpr ETrigPrecision DecimationPrecision = ETrigPrecision::Balanced;
+
+	/** Budget for a decimated sine over input that moves InPhaseRate radians per frame. The interpolation error follows
+	 *  h, the phase between two evaluated frames: h^2 / 8 for Linear and h^4 / 384 for Cubic, see
+	 *  EDecimationInterpolation. The evaluated frames add the kernel's error, and the float ramp and scaled input a few
+	 *  roundings more. A stride of 1 evaluates every frame, so only the kernel's error applies. */
+	FBudget GetDecimationBudget(int32 InStride, EDecimationInterpolation InInterpolation, double InPhaseRate, double InScale)
+	{
+		double InterpolationError = 0.0;
+		if (InStride > 1)
+		{
+			const double H = InPhaseRate * static_cast<double>(InStride);
+			InterpolationError = (EDecimationInterpolation::Cubic == InInterpolation) ? (H * H * H * H / 384.0) : (H * H / 8.0);
+		}
+
+		FBudget Budget;
+		Budget.MaxAbsoluteError = InterpolationError + GetTrigBudget(DecimationPrecision, true).MaxAbsoluteError + 3.0 * FloatUlpAtOne;
+		Budget.MaxAbsoluteErrorPerInputUnit = 3.0 * FloatRoundingError * InScale;
+
+		return Budget;
+	}
+
+	/** Input moving InPhaseRate radians per frame: a ramp in radians centred on zero, or a phasor in turns that wraps
+	 *  from 1 back to 0 the way a phase accumulator's output does. */
+	TArray<double> MakeDecimationInputs(double InPhaseRate, bool bInPhasor)
+	{
+		constexpr int32 NumFrames = 1 << 16;
+
+		TArray<double> Inputs;
+		Inputs.SetNumUninitialized(NumFrames);
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			if (bInPhasor)
+			{
+				const double Turns = InPhaseRate * static_cast<double>(Frame) / UE_DOUBLE_TWO_PI;
+				Inputs[Frame] = static_cast<float>(Turns - std::floor(Turns));
+			}
+			else
+			{
+				Inputs[Frame] = static_cast<float>(InPhaseRate * static_cast<double>(Frame - NumFrames / 2));
+			}
+		}
+
+		return Inputs;
+	}
+
+	/** Sweeps the decimated sine and sine-cosine over stride, interpolation and phase rate, holding each to the bound its
+	 *  h gives. Rates that move more than a radian per stride are skipped, as decimation is meant for slower input. */
+	void CheckDecimatedPaths(FAccuracyRunner& InRunner)
+	{
+		constexpr double SampleRate = 48000.0;
+		constexpr double MaxPhasePerStride = 1.0;
+		constexpr int32 Strides[] = {1, 8, 16, 32, 256};
+		constexpr double Frequencies[] = {1.0, 20.0, 100.0, 440.0, 1000.0};
+		constexpr EDecimationInterpolation Interpolations[] = {EDecimationInterpolation::Linear, EDecimationInterpolation::Cubic};
+		constexpr bool PhasorInputs[] = {false, true};
+
+		for (const bool bPhasor : PhasorInputs)
+		{
+			const double Scale = bPhasor ? UE_DOUBLE_TWO_PI : 1.0;
+			const TCHAR* InputName = bPhasor ? TEXT("Phasor") : TEXT("Ramp");
+
+			auto SinReference = [Scale](double InX) { return FMath::Sin(InX * Scale); };
+			auto CosReference = [Scale](double InX) { return FMath::Cos(InX * Scale); };
+
+			for (const double Frequency : Frequencies)
+			{
+				const double PhaseRate = UE_DOUBLE_TWO_PI * Frequency / SampleRate;
+				const TArray<double> Inputs = MakeDecimationInputs(PhaseRate, bPhasor);
+
+				for (const int32 Stride : Strides)
+				{
+					if (Stride > 1 && PhaseRate * static_cast<double>(Stride) > MaxPhasePerStride)
+					{
+						continue;
+					}
+
+					for (const EDecimationInterpolation Interpolation : Interpolations)
+					{
+						const FBudget Budget = GetDecimationBudget(Stride, Interpolation, PhaseRate, Scale);
+						const FString Name = FString::Printf(TEXT("%s/%d/%s/%g Hz"), LexToString(Interpolation), Stride, InputName, Frequency);
+
+						const TArray<double> Sin = EvaluateBlocks(Inputs, [Scale, Stride, Interpolation](int32 InStart, TArrayView<const float> In, TArrayView<float> Out)
+						{
+							ArraySinDecimated(In, Out, static_cast<float>(Scale), Stride, Interpolation, DecimationPrecision);
+						});
+
+						InRunner.Check(TEXT("SinDecimated/") + Name, Budget, Inputs, Sin, SinReference);
+
+						TArray<float> Cos;
+						Cos.SetNumZeroed(Inputs.Num());
+
+						const TArray<double> SinCosSin = EvaluateBlocks(Inputs, [Scale, Stride, Interpolation, &Cos](int32 InStart, TArrayView<const float> In, TArrayView<float> Out)
+						{
+							ArraySinCosDecimated(In, Out, MakeArrayView(Cos.GetData() + InStart, Out.Num()), static_cast<float>(Scale), Stride, Interpolation, DecimationPrecision);
+						});
+
+						InRunner.Check(TEXT("SinCosDecimated/") + Name + TEXT(".Sin"), Budget, Inputs, SinCosSin, SinReference);
+						InRunner.Check(TEXT("SinCosDecimated/") + Name + TEXT(".Cos"), Budget, Inputs, ToDouble(Cos), CosReference);
+					}
+				}
+			}
+		}
+	}
+
+	/** The decimated functions read each evaluated frame before writing the segment that ends on it, so their input may
+	 *  alias an output. Aliased calls must match separate buffers bit for bit. */
+	void CheckDecimatedAliasing(FAutomationTestBase& InTest)
+	{
+		constexpr int32 NumFrames = 509;
+		constexpr int32 Strides[] = {1, 8, 16, 32, 256};
+		constexpr EDecimationInterpolation Interpolations[] = {EDecimationInterpolation::Linear, EDecimationInterpolation::Cubic};
+		constexpr float Scale = UE_TWO_PI;
+
+		// A phasor that wraps once within the block.
+		TArray<float> Inputs;
+		Inputs.SetNumUninitialized(NumFrames);
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const double Turns = 0.75 + static_cast<double>(Frame) / 1000.0;
+			Inputs[Frame] = static_cast<float>(Turns - std::floor(Turns));
+		}
+
+		auto TestBitwiseEqual = [&InTest](const FString& InName, const TArray<float>& InActual, const TArray<float>& InExpected)
+		{
+			InTest.TestTrue(InName, 0 == FMemory::Memcmp(InActual.GetData(), InExpected.GetData(), InExpected.Num() * sizeof(float)));
+		};
+
+		for (const int32 Stride : Strides)
+		{
+			for (const EDecimationInterpolation Interpolation : Interpolations)
+			{
+				const FString Name = FString::Printf(TEXT("%s/%d"), LexToString(Interpolation), Stride);
+
+				TArray<float> Sin;
+				Sin.SetNumZeroed(NumFrames);
+				ArraySinDecimated(Inputs, Sin, Scale, Stride, Interpolation, DecimationPrecision);
+
+				TArray<float> InPlace = Inputs;
+				ArraySinDecimated(InPlace, InPlace, Scale, Stride, Interpolation, DecimationPrecision);
+				TestBitwiseEqual(FString::Printf(TEXT("SinDecimated/%s in place"), *Name), InPlace, Sin);
+
+				TArray<float> SinCosSin;
+				TArray<float> SinCosCos;
+				SinCosSin.SetNumZeroed(NumFrames);
+				SinCosCos.SetNumZeroed(NumFrames);
+				ArraySinCosDecimated(Inputs, SinCosSin, SinCosCos, Scale, Stride, Interpolation, DecimationPrecision);
+
+				TArray<float> AliasedSin = Inputs;
+				TArray<float> OtherCos;
+				OtherCos.SetNumZeroed(NumFrames);
+				ArraySinCosDecimated(AliasedSin, AliasedSin, OtherCos, Scale, Stride, Interpolation, DecimationPrecision);
+				TestBitwiseEqual(FString::Printf(TEXT("SinCosDecimated/%s in place on Sin.Sin"), *Name), AliasedSin, SinCosSin);
+				TestBitwiseEqual(FString::Printf(TEXT("SinCosDecimated/%s in place on Sin.Cos"), *Name), OtherCos, SinCosCos);
+
+				TArray<float> AliasedCos = Inputs;
+				TArray<float> OtherSin;
+				OtherSin.SetNumZeroed(NumFrames);
+				ArraySinCosDecimated(AliasedCos, OtherSin, AliasedCos, Scale, Stride, Interpolation, DecimationPrecision);
+				TestBitwiseEqual(FString::Printf(TEXT("SinCosDecimated/%s in place on Cos.Sin"), *Name), OtherSin, SinCosSin);
+				TestBitwiseEqual(FString::Printf(TEXT("SinCosDecimated/%s in place on Cos.Cos"), *Name), AliasedCos, SinCosCos);
+			}
+		}
+	}
+
+	void CheckOscillator(FAccuracyRunner& InRunner)
+	{
+		constexpr double SampleRate = 48000.0;
+		constexpr int32 BlockSize = 480;
+		constexpr int32 NumSamples = 60 * 48000;
+		constexpr double Frequencies[] = {1.0, 440.0, 12345.0};
+
+		// Drift between resyncs is bounded by one block of float rotations.
+		FBudget Budget;
+		Budget.MaxAbsoluteError = 5.0e-6;
+		Budget.RangeTolerance = 5.0e-6;
+
+		TArray<double> SampleIndices;
+		SampleIndices.SetNumUninitialized(NumSamples);
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			SampleIndices[Index] = Index;
+		}
+
+		for (const double Frequency : Frequencies)
+		{
+			const double Step = UE_DOUBLE_TWO_PI * Frequency / SampleRate;
+
+			FRotationOscillator Oscillator;
+			Oscillator.SetStep(Step);
+			Oscillator.SetPhase(0.0);
+
+			TArray<float> Samples;
+			Samples.SetNumZeroed(NumSamples);
+			for (int32 Start = 0; Start < NumSamples; Start += BlockSize)
+			{
+				Oscillator.Generate(MakeArrayView(Samples.GetData() + Start, FMath::Min(BlockSize, NumSamples - Start)));
+				Oscillator.Resync();
+			}
+
+			InRunner.Check(FString::Printf(TEXT("SineOscillator/%g Hz"), Frequency), Budget, SampleIndices, ToDouble(Samples), [Step](double InIndex)
+			{
+				return FMath::Sin(std::fmod(Step * InIndex, UE_DOUBLE_TWO_PI));
+			});
+		}
+	}
+
+	void CheckTimePhase(FAccuracyRunner& InRunner)
+	{
+		// Three days of 480 sample blocks at 48 kHz, driven by a time input that advances 10 ms per block.
+		constexpr double BlocksPerSecond = 100.0;
+		constexpr int64 NumBlocks = 72 * 3600 * 100;
+		constexpr int64 SampledBlockStride = 997;
+
+		constexpr double Frequencies[] = {1.0, 440.0, 440.1f, 12345.6f};
+
+		// Rounding of one phase step per block for three days, well below the float resolution of the output.
+		FBudget Budget;
+		Budget.MaxAbsoluteError = 1.0e-8;
+		Budget.Period = 1.0;
+		Budget.MinValue = 0.0;
+		Budget.MaxValue = 1.0;
+
+		for (const double Frequency : Frequencies)
+		{
+			FTimePhase Phase;
+			Phase.Reset(0.0, Frequency);
+
+			TArray<double> SampledTimes;
+			TArray<double> SampledTurns;
+			for (int64 Block = 1; Block <= NumBlocks; ++Block)
+			{
+				const double Seconds = static_cast<double>(Block) / BlocksPerSecond;
+				Phase.Advance(Seconds, Frequency);
+
+				if (Block % SampledBlockStride == 0)
+				{
+					SampledTimes.Add(Seconds);
+					SampledTurns.Add(Phase.GetTurns());
+				}
+			}
+
+			// Frequency * Time split into its rounded product and the exact rounding error, so the reference stays exact
+			// however many turns the product holds.
+			InRunner.Check(FString::Printf(TEXT("TimePhase/%g Hz/72 h"), Frequency), Budget, SampledTimes, SampledTurns, [Frequency](double InSeconds)
+			{
+				const double Product = Frequency * InSeconds;
+				const double ProductError = std::fma(Frequency, InSeconds, -Product);
+				return (Product - std::floor(Product)) + ProductError;
+			});
+		}
+	}
+
+	void CheckHeldTimePhase(FAutomationTestBase& InTest)
+	{
+		constexpr double Frequency = 440.0;
+		constexpr double HeldSeconds = 3600.25;
+
+		FTimePhase Phase;
+		Phase.Reset(0.0, Frequency);
+		Phase.Advance(HeldSeconds, Frequency);
+		const double HeldTurns = Phase.GetTurns();
+
+		// A Time input that stands still must neither move the phase nor report elapsed time, however long it is held.
+		bool bMoved = false;
+		bool bDrifted = false;
+		bool bElapsed = false;
+		for (int32 Block = 0; Block < 1000; ++Block)
+		{
+			bMoved |= Phase.Advance(HeldSeconds, Frequency);
+			const double Turns = Phase.GetTurns();
+			bDrifted |= 0 != FMemory::Memcmp(&HeldTurns, &Turns, sizeof(double));
+			bElapsed |= Phase.GetElapsedSeconds() != 0.0;
+		}
+		InTest.TestFalse(TEXT("HeldTimePhase/moved"), bMoved);
+		InTest.TestFalse(TEXT("HeldTimePhase/drifted"), bDrifted);
+		InTest.TestFalse(TEXT("HeldTimePhase/elapsed"), bElapsed);
+
+		// Releasing the hold continues from the held phase.
+		constexpr double ReleasedSeconds = HeldSeconds + 0.01;
+		InTest.TestTrue(TEXT("HeldTimePhase/released"), Phase.Advance(ReleasedSeconds, Frequency));
+		InTest.TestEqual(TEXT("HeldTimePhase/released elapsed"), Phase.GetElapsedSeconds(), ReleasedSeconds - HeldSeconds);
+		const double ExpectedTurns = Frequency * ReleasedSeconds;
+		InTest.TestTrue(TEXT("HeldTimePhase/released turns"), FMath::Abs(std::remainder(Phase.GetTurns() - ExpectedTurns, 1.0)) < 1.0e-9);
+
+		// The audio output holds by running its oscillator with no step.
+		constexpr int32 NumFrames = 509;
+		FRotationOscillator Oscillator;
+		Oscillator.SetStep(0.0);
+		Oscillator.SetPhase(Phase.GetRadians());
+
+		TArray<float> Samples;
+		Samples.SetNumZeroed(NumFrames);
+		Oscillator.Generate(Samples);
+
+		bool bConstant = true;
+		for (const float Sample : Samples)
+		{
+			bConstant &= Sample == Samples[0];
+		}
+		InTest.TestTrue(TEXT("HeldTimePhase/oscillator holds"), bConstant);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetasoundExtensionsSinAccuracyTest, "Audio.MetasoundExtensions.Accuracy.Sin", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetasoundExtensionsSinAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace MetasoundExtensionsAccuracyTestPrivate;
+
+	FAccuracyRunner Runner(*this);
+	const FAccuracyInputs Inputs;
+
+	ForEachBlockKernelSet(Runner, [&Runner, &Inputs]()
+	{
+		for (const ETrigPrecision Precision : AllTrigPrecisions)
+		{
+			CheckSinPaths(Runner, Precision, Inputs);
+		}
+	});
+
+	CheckSineDegreeFold(*this, Inputs);
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetasoundExtensionsSinCosAccuracyTest, "Audio.MetasoundExtensions.Accuracy.SinCos", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetasoundExtensionsSinCosAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace MetasoundExtensionsAccuracyTestPrivate;
+
+	FAccuracyRunner Runner(*this);
+	const FAccuracyInputs Inputs;
+
+	ForEachBlockKernelSet(Runner, [&Runner, &Inputs]()
+	{
+		for (const ETrigPrecision Precision : AllTrigPrecisions)
+		{
+			CheckSinCosPaths(Runner, Precision, Inputs);
+		}
+	});
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetasoundExtensionsIntegerDegreeAccuracyTest, "Audio.MetasoundExtensions.Accuracy.IntegerDegrees", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetasoundExtensionsIntegerDegreeAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace MetasoundExtensionsAccuracyTestPrivate;
+
+	FAccuracyRunner Runner(*this);
+	const FAccuracyInputs Inputs;
+
+	CheckIntegerDegreePaths(Runner, Inputs);
+	CheckIntegerDegreeZeroSigns(*this);
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetasoundExtensionsUnwindAccuracyTest, "Audio.MetasoundExtensions.Accuracy.Unwind", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetasoundExtensionsUnwindAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace MetasoundExtensionsAccuracyTestPrivate;
+
+	FAccuracyRunner Runner(*this);
+	const FAccuracyInputs Inputs;
+
+	ForEachBlockKernelSet(Runner, [&Runner, &Inputs]()
+	{
+		CheckUnwindPaths(Runner, Inputs);
+	});
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetasoundExtensionsConversionAccuracyTest, "Audio.MetasoundExtensions.Accuracy.Conversion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetasoundExtensionsConversionAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace MetasoundExtensionsAccuracyTestPrivate;
+
+	FAccuracyRunner Runner(*this);
+	const FAccuracyInputs Inputs;
+
+	ForEachBlockKernelSet(Runner, [&Runner, &Inputs]()
+	{
+		CheckConversionPaths<MetasoundDegreesToRadiansNodePrivate::FDegreesToRadiansPolicy>(Runner, TEXT("DegreesToRadians"), Inputs.Degrees, Inputs.Integers, RadiansPerDegree);
+		CheckConversionPaths<MetasoundRadiansToDegreesNodePrivate::FRadiansToDegreesPolicy>(Runner, TEXT("RadiansToDegrees"), Inputs.Radians, Inputs.Integers, DegreesPerRadian);
+	});
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetasoundExtensionsDecimationAccuracyTest, "Audio.MetasoundExtensions.Accuracy.Decimation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetasoundExtensionsDecimationAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace MetasoundExtensionsAccuracyTestPrivate;
+
+	FAccuracyRunner Runner(*this);
+	CheckDecimatedPaths(Runner);
+	CheckDecimatedAliasing(*this);
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetasoundExtensionsSineOscillatorAccuracyTest, "Audio.MetasoundExtensions.Accuracy.SineOscillator", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetasoundExtensionsSineOscillatorAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace MetasoundExtensionsAccuracyTestPrivate;
+
+	FAccuracyRunner Runner(*this);
+	CheckOscillator(Runner);
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetasoundExtensionsTimePhaseAccuracyTest, "Audio.MetasoundExtensions.Accuracy.TimePhase", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetasoundExtensionsTimePhaseAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace MetasoundExtensionsAccuracyTestPrivate;
+
+	FAccuracyRunner Runner(*this);
+	CheckTimePhase(Runner);
+	CheckHeldTimePhase(*this);
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,23 @@
+﻿using UnrealBuildTool;
+
+public class MetasoundExtensionsTools : ModuleRules
+{
+	public MetasoundExtensionsTools(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"AudioExtensions",
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"Json",
+				"MetasoundEngine",
+				"MetasoundFrontend",
+				"MetasoundGraphCore",
+			}
+		);
+	}
+}
@@ -0,0 +1,299 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsRenderCommandlet.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/UnrealMathUtility.h"
+#include "MetasoundSource.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Sound/SoundGenerator.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMetasoundExtensionsRender, Log, All);
+
+namespace MetasoundExtensionsRenderPrivate
+{
+	constexpr uint16 WaveFormatIeeeFloat = 3;
+
+	void AppendBytes(TArray<uint8>& OutData, const void* InBytes, int32 InNum)
+	{
+		OutData.Append(static_cast<const uint8*>(InBytes), InNum);
+	}
+
+	void AppendUint32(TArray<uint8>& OutData, uint32 InValue)
+	{
+		const uint8 Bytes[4] = {uint8(InValue), uint8(InValue >> 8), uint8(InValue >> 16), uint8(InValue >> 24)};
+		AppendBytes(OutData, Bytes, 4);
+	}
+
+	void AppendUint16(TArray<uint8>& OutData, uint16 InValue)
+	{
+		const uint8 Bytes[2] = {uint8(InValue), uint8(InValue >> 8)};
+		AppendBytes(OutData, Bytes, 2);
+	}
+
+	uint32 ReadUint32(const uint8* InData)
+	{
+		return uint32(InData[0]) | (uint32(InData[1]) << 8) | (uint32(InData[2]) << 16) | (uint32(InData[3]) << 24);
+	}
+
+	uint16 ReadUint16(const uint8* InData)
+	{
+		return uint16(InData[0]) | uint16(InData[1] << 8);
+	}
+
+	/** Writes interleaved samples as a 32-bit IEEE float WAV, so the file holds exactly what the graph produced. */
+	bool WriteFloatWave(const FString& InPath, TConstArrayView<float> InSamples, int32 InNumChannels, int32 InSampleRate)
+	{
+		const uint32 DataBytes = static_cast<uint32>(InSamples.Num() * sizeof(float));
+
+		TArray<uint8> File;
+		File.Reserve(44 + DataBytes);
+
+		AppendBytes(File, "RIFF", 4);
+		AppendUint32(File, 36 + DataBytes);
+		AppendBytes(File, "WAVE", 4);
+
+		AppendBytes(File, "fmt ", 4);
+		AppendUint32(File, 16);
+		AppendUint16(File, WaveFormatIeeeFloat);
+		AppendUint16(File, static_cast<uint16>(InNumChannels));
+		AppendUint32(File, static_cast<uint32>(InSampleRate));
+		AppendUint32(File, static_cast<uint32>(InSampleRate * InNumChannels * sizeof(float)));
+		AppendUint16(File, static_cast<uint16>(InNumChannels * sizeof(float)));
+		AppendUint16(File, 32);
+
+		AppendBytes(File, "data", 4);
+		AppendUint32(File, DataBytes);
+		AppendBytes(File, InSamples.GetData(), DataBytes);
+
+		return FFileHelper::SaveArrayToFile(File, *InPath);
+	}
+
+	/** Reads a WAV written by WriteFloatWave. Other formats are rejected rather than converted. */
+	bool ReadFloatWave(const FString& InPath, TArray<float>& OutSamples, int32& OutNumChannels, int32& OutSampleRate)
+	{
+		TArray<uint8> File;
+		if (!FFileHelper::LoadFileToArray(File, *InPath) || File.Num() < 12 || FMemory::Memcmp(File.GetData(), "RIFF", 4) != 0 || FMemory::Memcmp(File.GetData() + 8, "WAVE", 4) != 0)
+		{
+			return false;
+		}
+
+		bool bHasFormat = false;
+		int32 Offset = 12;
+		while (Offset + 8 <= File.Num())
+		{
+			const uint8* Chunk = File.GetData() + Offset;
+			const int32 ChunkSize = static_cast<int32>(ReadUint32(Chunk + 4));
+			if (ChunkSize < 0 || Offset + 8 + ChunkSize > File.Num())
+			{
+				return false;
+			}
+
+			if (FMemory::Memcmp(Chunk, "fmt ", 4) == 0 && ChunkSize >= 16)
+			{
+				if (ReadUint16(Chunk + 8) != WaveFormatIeeeFloat || ReadUint16(Chunk + 22) != 32)
+				{
+					return false;
+				}
+
+				OutNumChannels = ReadUint16(Chunk + 10);
+				OutSampleRate = static_cast<int32>(ReadUint32(Chunk + 12));
+				bHasFormat = true;
+			}
+			else if (FMemory::Memcmp(Chunk, "data", 4) == 0 && bHasFormat)
+			{
+				OutSamples.SetNumUninitialized(ChunkSize / sizeof(float));
+				FMemory::Memcpy(OutSamples.GetData(), Chunk + 8, OutSamples.Num() * sizeof(float));
+				return true;
+			}
+
+			// Chunks are padded to an even size.
+			Offset += 8 + ChunkSize + (ChunkSize & 1);
+		}
+
+		return false;
+	}
+
+	void SetConsoleVariable(const TCHAR* InName, int32 InValue)
+	{
+		if (IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(InName))
+		{
+			Variable->Set(InValue, ECVF_SetByCommandline);
+		}
+		else
+		{
+			UE_LOG(LogMetasoundExtensionsRender, Warning, TEXT("Console variable %s not found, the render may not be deterministic"), InName);
+		}
+	}
+
+	void SetConsoleVariable(const TCHAR* InName, float InValue)
+	{
+		if (IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(InName))
+		{
+			Variable->Set(InValue, ECVF_SetByCommandline);
+		}
+		else
+		{
+			UE_LOG(LogMetasoundExtensionsRender, Warning, TEXT("Console variable %s not found, the render may not be deterministic"), InName);
+		}
+	}
+}
+
+UMetasoundExtensionsRenderCommandlet::UMetasoundExtensionsRenderCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UMetasoundExtensionsRenderCommandlet::Main(const FString& Params)
+{
+	using namespace MetasoundExtensionsRenderPrivate;
+
+	FString AssetPath;
+	FString OutputPath;
+	FString BaselinePath;
+	double Seconds = 10.0;
+	int32 SampleRate = 48000;
+	int32 BlockSize = 256;
+	int32 Seed = 0;
+	float Tolerance = 0.0f;
+	FParse::Value(*Params, TEXT("Asset="), AssetPath);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+	FParse::Value(*Params, TEXT("Seconds="), Seconds);
+	FParse::Value(*Params, TEXT("SampleRate="), SampleRate);
+	FParse::Value(*Params, TEXT("BlockSize="), BlockSize);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+
+	if (AssetPath.IsEmpty() || OutputPath.IsEmpty() || SampleRate <= 0 || BlockSize <= 0 || Seconds <= 0.0)
+	{
+		UE_LOG(LogMetasoundExtensionsRender, Error, TEXT("Usage: -run=MetasoundExtensionsRender -Asset=<ObjectPath> -Output=<Path.wav> [-Seconds=10] [-SampleRate=48000] [-BlockSize=256] [-Seed=0] [-Baseline=<Path.wav>] [-Tolerance=0]"));
+		return 1;
+	}
+
+	UMetaSoundSource* Source = LoadObject<UMetaSoundSource>(nullptr, *AssetPath);
+	if (nullptr == Source)
+	{
+		UE_LOG(LogMetasoundExtensionsRender, Error, TEXT("Could not load MetaSound source %s"), *AssetPath);
+		return 1;
+	}
+
+	// Build the graph on this thread and render with the requested block size, so every run sees the same blocks.
+	SetConsoleVariable(TEXT("au.MetaSound.EnableAsyncGeneratorBuilder"), 0);
+	SetConsoleVariable(TEXT("au.MetaSound.BlockRate"), static_cast<float>(SampleRate) / static_cast<float>(BlockSize));
+
+	FMath::RandInit(Seed);
+	FMath::SRandInit(Seed);
+
+	const int32 NumChannels = FMath::Max(Source->NumChannels, 1);
+
+	FSoundGeneratorInitParams InitParams;
+	InitParams.SampleRate = static_cast<float>(SampleRate);
+	InitParams.AudioMixerNumOutputFrames = BlockSize;
+	InitParams.NumChannels = NumChannels;
+	InitParams.NumFramesPerCallback = BlockSize;
+	InitParams.InstanceID = static_cast<uint64>(Seed) + 1;
+	InitParams.GraphName = Source->GetName();
+
+	ISoundGeneratorPtr Generator = Source->CreateSoundGenerator(InitParams, {});
+	if (!Generator.IsValid())
+	{
+		UE_LOG(LogMetasoundExtensionsRender, Error, TEXT("Could not create a generator for %s"), *AssetPath);
+		return 1;
+	}
+
+	const int64 NumFrames = static_cast<int64>(FMath::CeilToDouble(Seconds * SampleRate));
+	const int32 SamplesPerBlock = BlockSize * NumChannels;
+
+	TArray<float> Samples;
+	Samples.SetNumZeroed(static_cast<int32>(NumFrames * NumChannels));
+
+	TArray<float> Block;
+	Block.SetNumZeroed(SamplesPerBlock);
+
+	const double RenderStart = FPlatformTime::Seconds();
+	for (int64 Frame = 0; Frame < NumFrames; Frame += BlockSize)
+	{
+		Generator->GetNextBuffer(Block.GetData(), SamplesPerBlock, true);
+
+		const int64 NumToCopy = FMath::Min<int64>(SamplesPerBlock, (NumFrames - Frame) * NumChannels);
+		FMemory::Memcpy(Samples.GetData() + Frame * NumChannels, Block.GetData(), NumToCopy * sizeof(float));
+	}
+	const double RenderSeconds = FMath::Max(FPlatformTime::Seconds() - RenderStart, 1.0e-9);
+
+	FSHAHash Hash;
+	FSHA1::HashBuffer(Samples.GetData(), Samples.Num() * sizeof(float), Hash.Hash);
+	const FString HashString = Hash.ToString();
+
+	UE_LOG(LogMetasoundExtensionsRender, Display, TEXT("Rendered %.2f s of %s (%d channels, %d Hz, %d frame blocks, seed %d) in %.3f s: %.1fx real time"),
+		Seconds, *AssetPath, NumChannels, SampleRate, BlockSize, Seed, RenderSeconds, Seconds / RenderSeconds);
+	UE_LOG(LogMetasoundExtensionsRender, Display, TEXT("SHA-1: %s"), *HashString);
+
+	if (!WriteFloatWave(OutputPath, Samples, NumChannels, SampleRate))
+	{
+		UE_LOG(LogMetasoundExtensionsRender, Error, TEXT("Failed to write %s"), *OutputPath);
+		return 1;
+	}
+
+	const FString HashPath = FPaths::ChangeExtension(OutputPath, TEXT("sha1"));
+	if (!FFileHelper::SaveStringToFile(HashString + TEXT("\n"), *HashPath))
+	{
+		UE_LOG(LogMetasoundExtensionsRender, Error, TEXT("Failed to write %s"), *HashPath);
+		return 1;
+	}
+
+	if (BaselinePath.IsEmpty())
+	{
+		return 0;
+	}
+
+	TArray<float> Baseline;
+	int32 BaselineChannels = 0;
+	int32 BaselineSampleRate = 0;
+	if (!ReadFloatWave(BaselinePath, Baseline, BaselineChannels, BaselineSampleRate))
+	{
+		UE_LOG(LogMetasoundExtensionsRender, Error, TEXT("Could not read baseline %s as a 32-bit float WAV"), *BaselinePath);
+		return 1;
+	}
+
+	if (BaselineChannels != NumChannels || BaselineSampleRate != SampleRate || Baseline.Num() != Samples.Num())
+	{
+		UE_LOG(LogMetasoundExtensionsRender, Error, TEXT("Baseline %s has %d channels at %d Hz and %d samples, expected %d channels at %d Hz and %d samples"),
+			*BaselinePath, BaselineChannels, BaselineSampleRate, Baseline.Num(), NumChannels, SampleRate, Samples.Num());
+		return 1;
+	}
+
+	double MaxDifference = 0.0;
+	int64 WorstSample = 0;
+	int64 NumDifferent = 0;
+	for (int32 Index = 0; Index < Samples.Num(); ++Index)
+	{
+		const double Difference = FMath::Abs(static_cast<double>(Samples[Index]) - static_cast<double>(Baseline[Index]));
+		const bool bIdentical = FMemory::Memcmp(&Samples[Index], &Baseline[Index], sizeof(float)) == 0;
+		if (!bIdentical)
+		{
+			++NumDifferent;
+
+			// NaN in either file counts as an unbounded difference.
+			const double Compared = FMath::IsNaN(Difference) ? TNumericLimits<double>::Max() : Difference;
+			if (Compared > MaxDifference)
+			{
+				MaxDifference = Compared;
+				WorstSample = Index;
+			}
+		}
+	}
+
+	const bool bPassed = (0 == NumDifferent) || (Tolerance > 0.0f && MaxDifference <= Tolerance);
+	UE_LOG(LogMetasoundExtensionsRender, Display, TEXT("%s against %s: %lld of %d samples differ, max difference %.3e at frame %lld channel %lld (tolerance %.3e)"),
+		bPassed ? TEXT("PASS") : TEXT("FAIL"), *BaselinePath, NumDifferent, Samples.Num(), MaxDifference, WorstSample / NumChannels, WorstSample % NumChannels, Tolerance);
+
+	return bPassed ? 0 : 1;
+}
@@ -0,0 +1,36 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "MetasoundExtensionsRenderCommandlet.generated.h"
+
+/** UMetasoundExtensionsRenderCommandlet
+ *
+ *  Renders a MetaSound source offline, faster than real time, with a fixed block size and random seed, and writes the
+ *  result to a 32-bit float WAV file along with a SHA-1 of the samples. Comparing hashes or files between two builds
+ *  shows whether a kernel change altered the output. Runs headless:
+ *
+ *  UnrealEditor-Cmd <Project> -run=MetasoundExtensionsRender -Asset=<ObjectPath> -Output=<Path.wav> [-Seconds=<Seconds>]
+ *      [-SampleRate=<Hz>] [-BlockSize=<Frames>] [-Seed=<Seed>] [-Baseline=<Path.wav>] [-Tolerance=<Amplitude>]
+ *
+ *  -Asset       Object path of the MetaSound source, e.g. /Game/Audio/MS_Ambience.MS_Ambience.
+ *  -Output      WAV file to write. The hash is written next to it with a .sha1 extension.
+ *  -Seconds     Duration to render. Defaults to 10.
+ *  -SampleRate  Defaults to 48000.
+ *  -BlockSize   Frames per render callback. Defaults to 256.
+ *  -Seed        Seed for the engine's random streams. Defaults to 0.
+ *  -Baseline    WAV written by an earlier run. Fails if any sample differs from it by more than the tolerance.
+ *  -Tolerance   Largest allowed difference from the baseline. Defaults to 0, which requires bit-identical output.
+ */
+UCLASS()
+class UMetasoundExtensionsRenderCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMetasoundExtensionsRenderCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,432 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "MetasoundExtensionsStressCommandlet.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundDataReference.h"
+#include "MetasoundEnvironment.h"
+#include "MetasoundFrontendRegistryContainer.h"
+#include "MetasoundGraph.h"
+#include "MetasoundOperatorBuilder.h"
+#include "MetasoundOperatorSettings.h"
+#include "MetasoundPrimitives.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMetasoundExtensionsStress, Log, All);
+
+namespace MetasoundExtensionsStressPrivate
+{
+	using namespace Metasound;
+
+	const FVertexName InputVertexName = TEXT("Input");
+	const FVertexName OutputVertexName = TEXT("Value");
+
+	/** A node class from the extension families. Every one of them reads "Input" and writes "Value". */
+	struct FNodeSpec
+	{
+		const TCHAR* Family;
+		int32 MinorVersion;
+	};
+
+	const FNodeSpec SinNode{TEXT("Sin"), 1};
+	const FNodeSpec DegSinNode{TEXT("DegSin"), 1};
+	const FNodeSpec UnwindDegreesNode{TEXT("UnwindDegrees"), 0};
+	const FNodeSpec UnwindRadiansNode{TEXT("UnwindRadians"), 0};
+	const FNodeSpec DegreesToRadiansNode{TEXT("DegreesToRadians"), 0};
+	const FNodeSpec RadiansToDegreesNode{TEXT("RadiansToDegrees"), 0};
+
+	/** One generator graph. The graph input feeds node 0, each edge connects "Value" to "Input", and OutputNode is
+	 *  exposed as the graph output. */
+	struct FGraphSpec
+	{
+		FString Name;
+		TArray<FNodeSpec> Nodes;
+		TArray<TPair<int32, int32>> Edges;
+		int32 OutputNode = 0;
+	};
+
+	TArray<FGraphSpec> MakeGraphSpecs()
+	{
+		TArray<FGraphSpec> Specs;
+
+		// Eight dependent sines, the cost of a deep chain.
+		{
+			FGraphSpec& Spec = Specs.AddDefaulted_GetRef();
+			Spec.Name = TEXT("SinChain");
+			for (int32 Index = 0; Index < 8; ++Index)
+			{
+				Spec.Nodes.Add(SinNode);
+				if (Index > 0)
+				{
+					Spec.Edges.Emplace(Index - 1, Index);
+				}
+			}
+			Spec.OutputNode = 7;
+		}
+
+		// An accumulated angle wrapped once and shared by several trig paths.
+		{
+			FGraphSpec& Spec = Specs.AddDefaulted_GetRef();
+			Spec.Name = TEXT("PhaseNetwork");
+			Spec.Nodes = {UnwindDegreesNode, DegSinNode, DegreesToRadiansNode, SinNode, UnwindRadiansNode, DegSinNode};
+			Spec.Edges = {{0, 1}, {0, 2}, {2, 3}, {2, 4}, {0, 5}};
+			Spec.OutputNode = 1;
+		}
+
+		// One conversion fanned out to eight converted and wrapped branches.
+		{
+			FGraphSpec& Spec = Specs.AddDefaulted_GetRef();
+			Spec.Name = TEXT("ConversionFanOut");
+			Spec.Nodes.Add(DegreesToRadiansNode);
+			for (int32 Branch = 0; Branch < 8; ++Branch)
+			{
+				const int32 ToDegrees = Spec.Nodes.Add(RadiansToDegreesNode);
+				const int32 Unwind = Spec.Nodes.Add(UnwindDegreesNode);
+				Spec.Edges.Emplace(0, ToDegrees);
+				Spec.Edges.Emplace(ToDegrees, Unwind);
+			}
+			Spec.OutputNode = 2;
+		}
+
+		return Specs;
+	}
+
+	/** Creates the graph from registered node classes of the given data type. Returns null if a class is missing. */
+	TUniquePtr<FGraph> BuildGraph(const FGraphSpec& InSpec, const FName& InDataTypeName)
+	{
+		TUniquePtr<FGraph> Graph = MakeUnique<FGraph>(InSpec.Name, FGuid::NewGuid());
+		TArray<FGuid> NodeIDs;
+
+		for (int32 Index = 0; Index < InSpec.Nodes.Num(); ++Index)
+		{
+			const FNodeSpec& NodeSpec = InSpec.Nodes[Index];
+			const FNodeClassName ClassName(NodeSpec.Family, NodeSpec.Family, InDataTypeName);
+			const Frontend::FNodeRegistryKey Key(EMetasoundFrontendClassType::External, ClassName, 1, NodeSpec.MinorVersion);
+
+			FNodeInitData InitData;
+			InitData.InstanceName = *FString::Printf(TEXT("%s_%d"), NodeSpec.Family, Index);
+			InitData.InstanceID = FGuid::NewGuid();
+
+			TUniquePtr<INode> Node = FMetasoundFrontendRegistryContainer::Get()->CreateNode(Key, InitData);
+			if (!Node.IsValid())
+			{
+				UE_LOG(LogMetasoundExtensionsStress, Error, TEXT("Node class %s %d.%d is not registered"), *ClassName.GetFullName().ToString(), 1, NodeSpec.MinorVersion);
+				return nullptr;
+			}
+
+			NodeIDs.Add(InitData.InstanceID);
+			Graph->AddNode(InitData.InstanceID, TSharedPtr<const INode>(Node.Release()));
+		}
+
+		bool bConnected = Graph->AddInputDataDestination(NodeIDs[0], InputVertexName);
+		for (const TPair<int32, int32>& Edge : InSpec.Edges)
+		{
+			bConnected &= Graph->AddDataEdge(NodeIDs[Edge.Key], OutputVertexName, NodeIDs[Edge.Value], InputVertexName);
+		}
+		bConnected &= Graph->AddOutputDataSource(NodeIDs[InSpec.OutputNode], OutputVertexName);
+
+		if (!bConnected)
+		{
+			UE_LOG(LogMetasoundExtensionsStress, Error, TEXT("Failed to connect graph %s"), *InSpec.Name);
+			return nullptr;
+		}
+
+		return Graph;
+	}
+
+	/** Writes the next block of input for one instance. Every instance gets its own phase so none of them can skip
+	 *  an evaluation because its input held still. */
+	void WriteInput(float& OutValue, int32 InInstance, int32 InBlock, int32 InFramesPerBlock)
+	{
+		OutValue = 3.0f * static_cast<float>(InBlock) + 0.01f * static_cast<float>(InInstance);
+	}
+
+	void WriteInput(FAudioBuffer& OutBuffer, int32 InInstance, int32 InBlock, int32 InFramesPerBlock)
+	{
+		const float Start = 0.05f * static_cast<float>(InBlock * InFramesPerBlock) + 0.01f * static_cast<float>(InInstance);
+		float* Data = OutBuffer.GetData();
+		for (int32 Frame = 0; Frame < OutBuffer.Num(); ++Frame)
+		{
+			Data[Frame] = Start + 0.05f * static_cast<float>(Frame);
+		}
+	}
+
+	struct FStressResult
+	{
+		FString Name;
+		int32 NumInstances = 0;
+		int32 NumNodesPerInstance = 0;
+		float SampleRate = 0.0f;
+		int32 FramesPerBlock = 0;
+		double BuildMillisecondsPerInstance = 0.0;
+		double BytesPerInstance = 0.0;
+		double MeanBlockMicroseconds = 0.0;
+		double P99BlockMicroseconds = 0.0;
+		double NanosecondsPerInstanceBlock = 0.0;
+
+		// Share of one core needed to render in real time.
+		double RealTimeLoad = 0.0;
+	};
+
+	template <typename DataType>
+	struct TInstance
+	{
+		TDataWriteReference<DataType> Input;
+		TUniquePtr<IOperator> Operator;
+		IOperator::FExecuteFunction Execute = nullptr;
+	};
+
+	/** Builds InNumInstances operators from the graph and renders InSeconds of audio through all of them. */
+	template <typename DataType>
+	bool RunCase(const FGraphSpec& InSpec, const FGraph& InGraph, const FOperatorSettings& InSettings, int32 InNumInstances, double InSeconds, FStressResult& OutResult)
+	{
+		FOperatorBuilderSettings BuilderSettings = FOperatorBuilderSettings::GetDefaultSettings();
+
+		// Side branches do not reach the graph output, but they are the load being measured.
+		BuilderSettings.PruningMode = EOperatorBuilderNodePruning::None;
+
+		FOperatorBuilder Builder(BuilderSettings);
+		FMetasoundEnvironment Environment;
+
+		TArray<TInstance<DataType>> Instances;
+		Instances.Reserve(InNumInstances);
+
+		const uint64 UsedMemoryBefore = FPlatformMemory::GetStats().UsedPhysical;
+		const double BuildStart = FPlatformTime::Seconds();
+
+		for (int32 Index = 0; Index < InNumInstances; ++Index)
+		{
+			TDataWriteReference<DataType> Input = TDataWriteReferenceFactory<DataType>::CreateAny(InSettings);
+
+			FInputVertexInterfaceData InputData(InGraph.GetVertexInterface().GetInputInterface());
+			InputData.BindReadVertex(InputVertexName, TDataReadReference<DataType>(Input));
+
+			FBuildResults Results;
+			FBuildGraphOperatorParams BuildParams{InGraph, InSettings, InputData, Environment};
+			TUniquePtr<IOperator> Operator = Builder.BuildGraphOperator(BuildParams, Results);
+			if (!Operator.IsValid())
+			{
+				UE_LOG(LogMetasoundExtensionsStress, Error, TEXT("Failed to build %s (%d errors)"), *InSpec.Name, Results.Errors.Num());
+				return false;
+			}
+
+			IOperator::FExecuteFunction Execute = Operator->GetExecuteFunction();
+			Instances.Add(TInstance<DataType>{Input, MoveTemp(Operator), Execute});
+		}
+
+		const double BuildSeconds = FPlatformTime::Seconds() - BuildStart;
+		const uint64 UsedMemoryAfter = FPlatformMemory::GetStats().UsedPhysical;
+
+		const int32 FramesPerBlock = InSettings.GetNumFramesPerBlock();
+		const int32 NumBlocks = FMath::Max(1, FMath::CeilToInt32(InSeconds * InSettings.GetSampleRate() / static_cast<double>(FramesPerBlock)));
+
+		TArray<double> BlockSeconds;
+		BlockSeconds.Reserve(NumBlocks);
+
+		for (int32 Block = 0; Block < NumBlocks; ++Block)
+		{
+			// Inputs are written outside the timed region; only the graphs' own work is measured.
+			for (int32 Index = 0; Index < Instances.Num(); ++Index)
+			{
+				WriteInput(*Instances[Index].Input, Index, Block, FramesPerBlock);
+			}
+
+			const double BlockStart = FPlatformTime::Seconds();
+			for (TInstance<DataType>& Instance : Instances)
+			{
+				if (Instance.Execute)
+				{
+					Instance.Execute(Instance.Operator.Get());
+				}
+			}
+			BlockSeconds.Add(FPlatformTime::Seconds() - BlockStart);
+		}
+
+		double TotalSeconds = 0.0;
+		for (const double Seconds : BlockSeconds)
+		{
+			TotalSeconds += Seconds;
+		}
+
+		BlockSeconds.Sort();
+		const double MeanBlockSeconds = TotalSeconds / static_cast<double>(NumBlocks);
+		const double BlockPeriod = static_cast<double>(FramesPerBlock) / InSettings.GetSampleRate();
+
+		OutResult.NumInstances = InNumInstances;
+		OutResult.NumNodesPerInstance = InSpec.Nodes.Num();
+		OutResult.SampleRate = InSettings.GetSampleRate();
+		OutResult.FramesPerBlock = FramesPerBlock;
+		OutResult.BuildMillisecondsPerInstance = 1.0e3 * BuildSeconds / static_cast<double>(InNumInstances);
+		OutResult.BytesPerInstance = UsedMemoryAfter > UsedMemoryBefore ? static_cast<double>(UsedMemoryAfter - UsedMemoryBefore) / static_cast<double>(InNumInstances) : 0.0;
+		OutResult.MeanBlockMicroseconds = 1.0e6 * MeanBlockSeconds;
+		OutResult.P99BlockMicroseconds = 1.0e6 * BlockSeconds[FMath::Min(NumBlocks - 1, (NumBlocks * 99) / 100)];
+		OutResult.NanosecondsPerInstanceBlock = 1.0e9 * MeanBlockSeconds / static_cast<double>(InNumInstances);
+		OutResult.RealTimeLoad = MeanBlockSeconds / BlockPeriod;
+
+		return true;
+	}
+
+	TArray<int32> ParseIntList(const FString& InParams, const TCHAR* InName, TArray<int32> InDefault)
+	{
+		FString Value;
+		if (!FParse::Value(*InParams, InName, Value, false))
+		{
+			return InDefault;
+		}
+
+		TArray<FString> Items;
+		Value.ParseIntoArray(Items, TEXT(","));
+
+		TArray<int32> Result;
+		for (const FString& Item : Items)
+		{
+			const int32 Parsed = FCString::Atoi(*Item);
+			if (Parsed > 0)
+			{
+				Result.Add(Parsed);
+			}
+		}
+
+		return Result.Num() > 0 ? Result : InDefault;
+	}
+
+	bool WriteJson(const FString& InPath, const TArray<FStressResult>& InResults)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("Cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+
+		TArray<TSharedPtr<FJsonValue>> ResultValues;
+		for (const FStressResult& Result : InResults)
+		{
+			TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+			ResultObject->SetStringField(TEXT("Name"), Result.Name);
+			ResultObject->SetNumberField(TEXT("Instances"), Result.NumInstances);
+			ResultObject->SetNumberField(TEXT("NodesPerInstance"), Result.NumNodesPerInstance);
+			ResultObject->SetNumberField(TEXT("SampleRate"), Result.SampleRate);
+			ResultObject->SetNumberField(TEXT("FramesPerBlock"), Result.FramesPerBlock);
+			ResultObject->SetNumberField(TEXT("BuildMillisecondsPerInstance"), Result.BuildMillisecondsPerInstance);
+			ResultObject->SetNumberField(TEXT("BytesPerInstance"), Result.BytesPerInstance);
+			ResultObject->SetNumberField(TEXT("MeanBlockMicroseconds"), Result.MeanBlockMicroseconds);
+			ResultObject->SetNumberField(TEXT("P99BlockMicroseconds"), Result.P99BlockMicroseconds);
+			ResultObject->SetNumberField(TEXT("NanosecondsPerInstanceBlock"), Result.NanosecondsPerInstanceBlock);
+			ResultObject->SetNumberField(TEXT("RealTimeLoad"), Result.RealTimeLoad);
+			ResultValues.Add(MakeShared<FJsonValueObject>(ResultObject));
+		}
+
+		Root->SetArrayField(TEXT("Results"), ResultValues);
+
+		FString Json;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		if (!FJsonSerializer::Serialize(Root, Writer))
+		{
+			return false;
+		}
+
+		return FFileHelper::SaveStringToFile(Json, *InPath);
+	}
+}
+
+UMetasoundExtensionsStressCommandlet::UMetasoundExtensionsStressCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UMetasoundExtensionsStressCommandlet::Main(const FString& Params)
+{
+	using namespace Metasound;
+	using namespace MetasoundExtensionsStressPrivate;
+
+	const TArray<int32> Counts = ParseIntList(Params, TEXT("Counts="), {1, 10, 100, 1000, 10000});
+	const TArray<int32> SampleRates = ParseIntList(Params, TEXT("SampleRates="), {48000, 96000});
+	const TArray<int32> BlockSizes = ParseIntList(Params, TEXT("BlockSizes="), {256, 1024});
+
+	double Seconds = 1.0;
+	FString Filter;
+	FString JsonPath;
+	FParse::Value(*Params, TEXT("Seconds="), Seconds);
+	FParse::Value(*Params, TEXT("Filter="), Filter);
+	FParse::Value(*Params, TEXT("Json="), JsonPath);
+
+	UE_LOG(LogMetasoundExtensionsStress, Display, TEXT("CPU: %s"), *FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	UE_LOG(LogMetasoundExtensionsStress, Display, TEXT("%-24s %6s %6s %6s %9s %12s %12s %12s %12s %12s %8s"),
+		TEXT("Graph"), TEXT("Count"), TEXT("Rate"), TEXT("Block"), TEXT("Nodes"), TEXT("build ms"), TEXT("bytes/inst"), TEXT("block us"), TEXT("p99 us"), TEXT("ns/inst"), TEXT("load"));
+
+	TArray<FStressResult> Results;
+	int32 ExitCode = 0;
+
+	for (const FGraphSpec& Spec : MakeGraphSpecs())
+	{
+		for (const bool bAudio : {false, true})
+		{
+			const FName DataTypeName = bAudio ? GetMetasoundDataTypeName<FAudioBuffer>() : GetMetasoundDataTypeName<float>();
+			const FString Name = FString::Printf(TEXT("%s/%s"), *Spec.Name, *DataTypeName.ToString());
+			if (!Filter.IsEmpty() && !Name.Contains(Filter))
+			{
+				continue;
+			}
+
+			const TUniquePtr<FGraph> Graph = BuildGraph(Spec, DataTypeName);
+			if (!Graph.IsValid())
+			{
+				ExitCode = 1;
+				continue;
+			}
+
+			for (const int32 SampleRate : SampleRates)
+			{
+				for (const int32 BlockSize : BlockSizes)
+				{
+					const FOperatorSettings Settings(SampleRate, static_cast<float>(SampleRate) / static_cast<float>(BlockSize));
+
+					for (const int32 Count : Counts)
+					{
+						FStressResult Result;
+						Result.Name = Name;
+
+						const bool bSucceeded = bAudio
+							? RunCase<FAudioBuffer>(Spec, *Graph, Settings, Count, Seconds, Result)
+							: RunCase<float>(Spec, *Graph, Settings, Count, Seconds, Result);
+
+						if (!bSucceeded)
+						{
+							ExitCode = 1;
+							break;
+						}
+
+						UE_LOG(LogMetasoundExtensionsStress, Display, TEXT("%-24s %6d %6d %6d %9d %12.4f %12.0f %12.1f %12.1f %12.1f %7.1f%%"),
+							*Result.Name, Result.NumInstances, SampleRate, Result.FramesPerBlock, Result.NumNodesPerInstance * Result.NumInstances,
+							Result.BuildMillisecondsPerInstance, Result.BytesPerInstance, Result.MeanBlockMicroseconds, Result.P99BlockMicroseconds,
+							Result.NanosecondsPerInstanceBlock, 100.0 * Result.RealTimeLoad);
+
+						Results.Add(MoveTemp(Result));
+					}
+				}
+			}
+		}
+	}
+
+	if (!JsonPath.IsEmpty())
+	{
+		if (WriteJson(JsonPath, Results))
+		{
+			UE_LOG(LogMetasoundExtensionsStress, Display, TEXT("Wrote %d results to %s"), Results.Num(), *JsonPath);
+		}
+		else
+		{
+			UE_LOG(LogMetasoundExtensionsStress, Error, TEXT("Failed to write results to %s"), *JsonPath);
+			ExitCode = 1;
+		}
+	}
+
+	return ExitCode;
+}
@@ -0,0 +1,35 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "MetasoundExtensionsStressCommandlet.generated.h"
+
+/** UMetasoundExtensionsStressCommandlet
+ *
+ *  Builds MetaSound graphs from the extension nodes (Sin chains, UnwindDegrees/DegSin phase networks and conversion
+ *  fan-outs), instantiates up to thousands of operators per graph and renders them offline, without an audio device.
+ *  Unlike the kernel benchmark this pays for the graph: virtual dispatch, data references and cache misses between
+ *  instances. Reports operator build time, memory per instance and per-block render cost.
+ *
+ *  UnrealEditor-Cmd <Project> -run=MetasoundExtensionsStress [-Counts=1,10,100,1000,10000] [-SampleRates=48000,96000]
+ *      [-BlockSizes=256,1024] [-Seconds=<Seconds>] [-Filter=<Text>] [-Json=<Path>]
+ *
+ *  -Counts       Operator instances per graph.
+ *  -SampleRates  Sample rates to render at.
+ *  -BlockSizes   Frames per block to render with.
+ *  -Seconds      Audio rendered per case. Defaults to 1.
+ *  -Filter       Only runs cases whose "Graph/DataType" name contains the text.
+ *  -Json         Also writes the results to a JSON file.
+ */
+UCLASS()
+class UMetasoundExtensionsStressCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMetasoundExtensionsStressCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,5 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, MetasoundExtensionsTools)
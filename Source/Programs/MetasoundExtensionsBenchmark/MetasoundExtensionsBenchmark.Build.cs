@@ -0,0 +1,28 @@
+﻿using System.IO;
+using EpicGames.Core;
+using UnrealBuildTool;
+
+public class MetasoundExtensionsBenchmark : ModuleRules
+{
+	public MetasoundExtensionsBenchmark(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateIncludePathModuleNames.Add("Launch");
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"Json",
+				"MetasoundExtensionsMath",
+				"Projects",
+			}
+		);
+
+		// Programs do not load plugin descriptors, so the version written to the JSON results is read from it at build time.
+		JsonObject Descriptor = JsonObject.Read(new FileReference(Path.Combine(ModuleDirectory, "..", "..", "..", "MetasoundExtensions.uplugin")));
+		PrivateDefinitions.Add("METASOUND_EXTENSIONS_VERSION=" + Descriptor.GetIntegerField("Version"));
+		PrivateDefinitions.Add("METASOUND_EXTENSIONS_VERSION_NAME=\"" + Descriptor.GetStringField("VersionName") + "\"");
+	}
+}
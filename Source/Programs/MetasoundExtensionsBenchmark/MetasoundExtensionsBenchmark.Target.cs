@@ -0,0 +1,27 @@
+﻿using UnrealBuildTool;
+
+// Stand-alone console build of the math kernel benchmark, which needs neither the editor nor a project. Build it with
+// UnrealBuildTool like any other target, e.g. "RunUBT.sh MetasoundExtensionsBenchmark Linux Development", and see
+// MetasoundExtensionsBenchmark.cpp for its arguments.
+[SupportedPlatforms(UnrealPlatformClass.Desktop)]
+public class MetasoundExtensionsBenchmarkTarget : TargetRules
+{
+	public MetasoundExtensionsBenchmarkTarget(TargetInfo Target) : base(Target)
+	{
+		Type = TargetType.Program;
+		LinkType = TargetLinkType.Monolithic;
+		LaunchModuleName = "MetasoundExtensionsBenchmark";
+		DefaultBuildSettings = BuildSettingsVersion.Latest;
+		IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
+
+		// Only Core, Json and the math module are linked, so the kernels are timed without the engine running around them.
+		bBuildDeveloperTools = false;
+		bCompileAgainstEngine = false;
+		bCompileAgainstCoreUObject = false;
+		bCompileAgainstApplicationCore = false;
+		bCompileICU = false;
+		bIsBuildingConsoleApplication = true;
+
+		EnablePlugins.Add("MetasoundExtensions");
+	}
+}
@@ -0,0 +1,484 @@
+// Copyright Hitbox Games, LLC. All Rights Reserved.
+
+#include "RequiredProgramMainCPPInclude.h"
+
+#include "Algo/Find.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProperties.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "MetasoundExtensionsDecimation.h"
+#include "MetasoundExtensionsMath.h"
+#include "MetasoundExtensionsSineTable.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#if PLATFORM_WINDOWS
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogMetasoundExtensionsBenchmark, Log, All);
+
+IMPLEMENT_APPLICATION(MetasoundExtensionsBenchmark, "MetasoundExtensionsBenchmark");
+
+/** MetasoundExtensionsBenchmark
+ *
+ *  Times every math kernel behind the node families, for each precision mode, on scalar values, single audio
+ *  blocks (256, 512 and 1024 samples) and a large array that does not fit in cache. Links only Core and the math
+ *  module, so it runs without the editor or a project:
+ *
+ *  MetasoundExtensionsBenchmark [-Json=<Path>] [-Filter=<Text>] [-MinTime=<Seconds>] [-Trials=<Count>]
+ *      [-Tier=<Baseline|Avx2|Avx512>] [-Ispc=<0|1>]
+ *
+ *  -Json     Also writes the results, plugin version and CPU to a JSON file, for comparing runs between versions.
+ *  -Filter   Only runs cases whose "Kernel/Precision/Shape" name contains the text.
+ *  -MinTime  Seconds spent in each trial. Defaults to 0.05.
+ *  -Trials   Trials per case; the fastest is reported. Defaults to 5.
+ *  -Tier     Vector tier for the block kernels. Defaults to the widest the CPU supports; fails if the CPU cannot run it.
+ *  -Ispc     Runs the block kernels through ISPC (1) or the hand-written tier (0). Defaults to 0.
+ */
+
+namespace MetasoundExtensionsBenchmarkPrivate
+{
+	using namespace Metasound::ExtensionsMath;
+
+	constexpr int32 ScalarBatchSize = 1024;
+	constexpr int32 BlockSizes[] = {256, 512, 1024};
+
+	// Four times a typical L2 cache once input and output are counted, so the array cases measure streaming throughput.
+	constexpr int32 ArraySize = 1 << 18;
+
+	/** Cycle counts come from the time stamp counter, which ticks at a fixed reference rate rather than the current
+	 *  core clock. Values per cycle is therefore comparable between runs on one machine, not across machines. */
+	bool HasCycleCounter()
+	{
+		return PLATFORM_CPU_X86_FAMILY != 0;
+	}
+
+	uint64 ReadCycleCounter()
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		return __rdtsc();
+#else
+		return 0;
+#endif
+	}
+
+	// Written after every trial so the optimizer cannot drop the work being timed.
+	volatile float Sink = 0.0f;
+
+	struct FBenchmarkResult
+	{
+		FString Kernel;
+		FString Precision;
+		FString Shape;
+		int32 ValuesPerCall = 0;
+		double NanosecondsPerValue = 0.0;
+		double ValuesPerCycle = 0.0;
+	};
+
+	class FBenchmarkRunner
+	{
+	public:
+		FBenchmarkRunner(double InMinSeconds, int32 InNumTrials, const FString& InFilter)
+			: MinSeconds(FMath::Max(InMinSeconds, 0.001))
+			, NumTrials(FMath::Max(InNumTrials, 1))
+			, Filter(InFilter)
+		{
+		}
+
+		/** Times InFunction, which processes InValuesPerCall values per call, and records the fastest trial. */
+		template <typename FunctionType>
+		void Run(const TCHAR* InKernel, const TCHAR* InPrecision, const TCHAR* InShape, int32 InValuesPerCall, FunctionType&& InFunction)
+		{
+			const FString Name = FString::Printf(TEXT("%s/%s/%s"), InKernel, InPrecision, InShape);
+			if (!Filter.IsEmpty() && !Name.Contains(Filter))
+			{
+				return;
+			}
+
+			// Warm the caches and branch predictors, then find a call count that fills one trial.
+			InFunction();
+
+			int64 NumCalls = 1;
+			for (;;)
+			{
+				const double StartSeconds = FPlatformTime::Seconds();
+				for (int64 Call = 0; Call < NumCalls; ++Call)
+				{
+					InFunction();
+				}
+
+				const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+				if (ElapsedSeconds >= MinSeconds || NumCalls >= (int64(1) << 40))
+				{
+					break;
+				}
+
+				NumCalls *= 2;
+			}
+
+			double BestSeconds = TNumericLimits<double>::Max();
+			uint64 BestCycles = TNumericLimits<uint64>::Max();
+			for (int32 Trial = 0; Trial < NumTrials; ++Trial)
+			{
+				const uint64 StartCycles = ReadCycleCounter();
+				const double StartSeconds = FPlatformTime::Seconds();
+				for (int64 Call = 0; Call < NumCalls; ++Call)
+				{
+					InFunction();
+				}
+
+				const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+				const uint64 ElapsedCycles = ReadCycleCounter() - StartCycles;
+
+				BestSeconds = FMath::Min(BestSeconds, ElapsedSeconds);
+				BestCycles = FMath::Min(BestCycles, ElapsedCycles);
+			}
+
+			const double NumValues = static_cast<double>(NumCalls) * static_cast<double>(InValuesPerCall);
+
+			FBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+			Result.Kernel = InKernel;
+			Result.Precision = InPrecision;
+			Result.Shape = InShape;
+			Result.ValuesPerCall = InValuesPerCall;
+			Result.NanosecondsPerValue = BestSeconds * 1.0e9 / NumValues;
+			Result.ValuesPerCycle = (HasCycleCounter() && BestCycles > 0) ? NumValues / static_cast<double>(BestCycles) : 0.0;
+
+			UE_LOG(LogMetasoundExtensionsBenchmark, Display, TEXT("%-18s %-12s %-12s %8d %12.3f %12.3f"),
+				InKernel, InPrecision, InShape, InValuesPerCall, Result.NanosecondsPerValue, Result.ValuesPerCycle);
+		}
+
+		const TArray<FBenchmarkResult>& GetResults() const
+		{
+			return Results;
+		}
+
+	private:
+		double MinSeconds = 0.05;
+		int32 NumTrials = 5;
+		FString Filter;
+
+		TArray<FBenchmarkResult> Results;
+	};
+
+	/** Inputs shared by every case. Seeded, so each run times the same values. */
+	struct FBenchmarkData
+	{
+		TArray<float> Radians;
+		TArray<float> Degrees;
+		TArray<int32> IntegerDegrees;
+		TArray<float> OutA;
+		TArray<float> OutB;
+
+		FBenchmarkData()
+		{
+			FRandomStream Random(0x4d455441);
+
+			Radians.SetNumUninitialized(ArraySize);
+			Degrees.SetNumUninitialized(ArraySize);
+			IntegerDegrees.SetNumUninitialized(ArraySize);
+			OutA.SetNumZeroed(ArraySize);
+			OutB.SetNumZeroed(ArraySize);
+
+			for (int32 Index = 0; Index < ArraySize; ++Index)
+			{
+				Radians[Index] = Random.FRandRange(-64.0f * UE_PI, 64.0f * UE_PI);
+				Degrees[Index] = Random.FRandRange(-3600.0f, 3600.0f);
+				IntegerDegrees[Index] = Random.RandRange(-100000, 100000);
+			}
+		}
+	};
+
+	/** Runs InArrayFunction(In, Out) over each block size and then over the whole array. */
+	template <typename ArrayFunctionType>
+	void RunBlocks(FBenchmarkRunner& InRunner, const TCHAR* InKernel, const TCHAR* InPrecision, const TArray<float>& InValues, FBenchmarkData& InData, ArrayFunctionType&& InArrayFunction)
+	{
+		for (const int32 BlockSize : BlockSizes)
+		{
+			InRunner.Run(InKernel, InPrecision, TEXT("Block"), BlockSize, [&]()
+			{
+				InArrayFunction(MakeArrayView(InValues.GetData(), BlockSize), MakeArrayView(InData.OutA.GetData(), BlockSize));
+				Sink = InData.OutA[0];
+			});
+		}
+
+		InRunner.Run(InKernel, InPrecision, TEXT("Array"), ArraySize, [&]()
+		{
+			InArrayFunction(MakeArrayView(InValues), MakeArrayView(InData.OutA));
+			Sink = InData.OutA[0];
+		});
+	}
+
+	/** Runs InScalarFunction over a batch of values, accumulating the results so none of them can be skipped. */
+	template <typename ValueType, typename ScalarFunctionType>
+	void RunScalar(FBenchmarkRunner& InRunner, const TCHAR* InKernel, const TCHAR* InPrecision, const TCHAR* InShape, const TArray<ValueType>& InValues, ScalarFunctionType&& InScalarFunction)
+	{
+		InRunner.Run(InKernel, InPrecision, InShape, ScalarBatchSize, [&]()
+		{
+			float Sum = 0.0f;
+			for (int32 Index = 0; Index < ScalarBatchSize; ++Index)
+			{
+				Sum += InScalarFunction(InValues[Index]);
+			}
+
+			Sink = Sum;
+		});
+	}
+
+	void RunTrigBenchmarks(FBenchmarkRunner& InRunner, FBenchmarkData& InData)
+	{
+		for (const ETrigPrecision Precision : AllTrigPrecisions)
+		{
+			const TCHAR* PrecisionName = LexToString(Precision);
+			const FSinKernel& SinKernel = GetSinKernel(Precision);
+			const FSinCosKernel& SinCosKernel = GetSinCosKernel(Precision);
+
+			RunScalar(InRunner, TEXT("Sin"), PrecisionName, TEXT("Scalar"), InData.Radians, [&](float InX) { return SinKernel.Sin(InX); });
+			RunScalar(InRunner, TEXT("Sin"), PrecisionName, TEXT("ScalarDouble"), InData.Radians, [&](float InX) { return static_cast<float>(SinKernel.SinDouble(InX)); });
+			RunBlocks(InRunner, TEXT("Sin"), PrecisionName, InData.Radians, InData, [&](TArrayView<const float> In, TArrayView<float> Out) { SinKernel.ArraySin(In, Out, 1.0f); });
+
+			RunScalar(InRunner, TEXT("DegSin"), PrecisionName, TEXT("ScalarDouble"), InData.Degrees, [&](float InX) { return static_cast<float>(SinDegrees(InX, SinKernel)); });
+			RunBlocks(InRunner, TEXT("DegSin"), PrecisionName, InData.Degrees, InData, [&](TArrayView<const float> In, TArrayView<float> Out) { ArraySinDegrees(In, Out, SinKernel); });
+
+			RunScalar(InRunner, TEXT("SinCos"), PrecisionName, TEXT("Scalar"), InData.Radians, [&](float InX)
+			{
+				float Sin = 0.0f;
+				float Cos = 0.0f;
+				SinCosKernel.SinCos(InX, Sin, Cos);
+				return Sin + Cos;
+			});
+			RunBlocks(InRunner, TEXT("SinCos"), PrecisionName, InData.Radians, InData, [&](TArrayView<const float> In, TArrayView<float> Out)
+			{
+				SinCosKernel.ArraySinCos(In, Out, MakeArrayView(InData.OutB.GetData(), Out.Num()), 1.0f);
+			});
+
+			RunScalar(InRunner, TEXT("DegSinCos"), PrecisionName, TEXT("ScalarDouble"), InData.Degrees, [&](float InX)
+			{
+				double Sin = 0.0;
+				double Cos = 0.0;
+				SinCosDegrees(InX, Sin, Cos, SinCosKernel);
+				return static_cast<float>(Sin + Cos);
+			});
+			RunBlocks(InRunner, TEXT("DegSinCos"), PrecisionName, InData.Degrees, InData, [&](TArrayView<const float> In, TArrayView<float> Out)
+			{
+				ArraySinCosDegrees(In, Out, MakeArrayView(InData.OutB.GetData(), Out.Num()), SinCosKernel);
+			});
+		}
+
+		RunScalar(InRunner, TEXT("DegSin"), TEXT("-"), TEXT("ScalarInt32"), InData.IntegerDegrees, [](int32 InX) { return SinIntegerDegrees(InX); });
+		RunScalar(InRunner, TEXT("DegSinCos"), TEXT("-"), TEXT("ScalarInt32"), InData.IntegerDegrees, [](int32 InX)
+		{
+			float Sin = 0.0f;
+			float Cos = 0.0f;
+			SinCosIntegerDegrees(InX, Sin, Cos);
+			return Sin + Cos;
+		});
+	}
+
+	void RunDecimationBenchmarks(FBenchmarkRunner& InRunner, FBenchmarkData& InData)
+	{
+		// Timing does not depend on how smooth the input is, so the random phases serve here too.
+		const TCHAR* PrecisionName = LexToString(ETrigPrecision::Balanced);
+		for (const EDecimationInterpolation Interpolation : {EDecimationInterpolation::Linear, EDecimationInterpolation::Cubic})
+		{
+			for (const int32 Stride : {8, 16, 32})
+			{
+				const FString SinKernelName = FString::Printf(TEXT("SinDecimated%d%s"), Stride, LexToString(Interpolation));
+				RunBlocks(InRunner, *SinKernelName, PrecisionName, InData.Radians, InData, [&](TArrayView<const float> In, TArrayView<float> Out)
+				{
+					ArraySinDecimated(In, Out, 1.0f, Stride, Interpolation, ETrigPrecision::Balanced);
+				});
+
+				const FString SinCosKernelName = FString::Printf(TEXT("SinCosDecimated%d%s"), Stride, LexToString(Interpolation));
+				RunBlocks(InRunner, *SinCosKernelName, PrecisionName, InData.Radians, InData, [&](TArrayView<const float> In, TArrayView<float> Out)
+				{
+					ArraySinCosDecimated(In, Out, MakeArrayView(InData.OutB.GetData(), Out.Num()), 1.0f, Stride, Interpolation, ETrigPrecision::Balanced);
+				});
+			}
+		}
+	}
+
+	void RunConversionBenchmarks(FBenchmarkRunner& InRunner, FBenchmarkData& InData)
+	{
+		RunScalar(InRunner, TEXT("UnwindDegrees"), TEXT("-"), TEXT("Scalar"), InData.Degrees, [](float InX) { return UnwindDegrees(InX); });
+		RunScalar(InRunner, TEXT("UnwindDegrees"), TEXT("-"), TEXT("ScalarInt32"), InData.IntegerDegrees, [](int32 InX) { return static_cast<float>(UnwindIntegerDegrees(InX)); });
+		RunBlocks(InRunner, TEXT("UnwindDegrees"), TEXT("-"), InData.Degrees, InData, [](TArrayView<const float> In, TArrayView<float> Out) { ArrayUnwindDegrees(In, Out); });
+
+		RunScalar(InRunner, TEXT("UnwindRadians"), TEXT("-"), TEXT("Scalar"), InData.Radians, [](float InX) { return UnwindRadians(InX); });
+		RunBlocks(InRunner, TEXT("UnwindRadians"), TEXT("-"), InData.Radians, InData, [](TArrayView<const float> In, TArrayView<float> Out) { ArrayUnwindRadians(In, Out); });
+
+		RunScalar(InRunner, TEXT("DegreesToRadians"), TEXT("-"), TEXT("Scalar"), InData.Degrees, [](float InX) { return FMath::DegreesToRadians(InX); });
+		RunBlocks(InRunner, TEXT("DegreesToRadians"), TEXT("-"), InData.Degrees, InData, [](TArrayView<const float> In, TArrayView<float> Out) { ArrayScale(In, Out, UE_PI / 180.0f); });
+
+		RunScalar(InRunner, TEXT("RadiansToDegrees"), TEXT("-"), TEXT("Scalar"), InData.Radians, [](float InX) { return FMath::RadiansToDegrees(InX); });
+		RunBlocks(InRunner, TEXT("RadiansToDegrees"), TEXT("-"), InData.Radians, InData, [](TArrayView<const float> In, TArrayView<float> Out) { ArrayScale(In, Out, 180.0f / UE_PI); });
+	}
+
+	void RunOscillatorBenchmarks(FBenchmarkRunner& InRunner, FBenchmarkData& InData)
+	{
+		FRotationOscillator Oscillator;
+		Oscillator.SetStep(UE_DOUBLE_TWO_PI * 440.0 / 48000.0);
+
+		// Mirrors the node: one block of samples, then a resync.
+		RunBlocks(InRunner, TEXT("SineOscillator"), TEXT("-"), InData.Radians, InData, [&Oscillator](TArrayView<const float> In, TArrayView<float> Out)
+		{
+			Oscillator.Generate(Out);
+			Oscillator.Resync();
+		});
+	}
+
+	bool WriteJson(const FString& InPath, const TArray<FBenchmarkResult>& InResults)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+
+		Root->SetStringField(TEXT("PluginVersion"), ANSI_TO_TCHAR(METASOUND_EXTENSIONS_VERSION_NAME));
+		Root->SetNumberField(TEXT("PluginVersionNumber"), METASOUND_EXTENSIONS_VERSION);
+
+		Root->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+		Root->SetStringField(TEXT("Cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+		Root->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+		Root->SetNumberField(TEXT("SineTableSize"), GetSineTableSize());
+		Root->SetStringField(TEXT("VectorTier"), LexToString(GetVectorTier()));
+		Root->SetStringField(TEXT("SupportedVectorTier"), LexToString(GetSupportedVectorTier()));
+		Root->SetBoolField(TEXT("Ispc"), IsUsingIspcKernels());
+		Root->SetBoolField(TEXT("HasCycleCounter"), HasCycleCounter());
+
+		TArray<TSharedPtr<FJsonValue>> ResultValues;
+		for (const FBenchmarkResult& Result : InResults)
+		{
+			TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+			ResultObject->SetStringField(TEXT("Kernel"), Result.Kernel);
+			ResultObject->SetStringField(TEXT("Precision"), Result.Precision);
+			ResultObject->SetStringField(TEXT("Shape"), Result.Shape);
+			ResultObject->SetNumberField(TEXT("ValuesPerCall"), Result.ValuesPerCall);
+			ResultObject->SetNumberField(TEXT("NanosecondsPerValue"), Result.NanosecondsPerValue);
+			if (HasCycleCounter())
+			{
+				ResultObject->SetNumberField(TEXT("ValuesPerCycle"), Result.ValuesPerCycle);
+			}
+
+			ResultValues.Add(MakeShared<FJsonValueObject>(ResultObject));
+		}
+
+		Root->SetArrayField(TEXT("Results"), ResultValues);
+
+		FString Json;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		if (!FJsonSerializer::Serialize(Root, Writer))
+		{
+			return false;
+		}
+
+		return FFileHelper::SaveStringToFile(Json, *InPath);
+	}
+
+	int32 RunBenchmarks(const TCHAR* Params)
+	{
+		double MinSeconds = 0.05;
+		int32 NumTrials = 5;
+		FString Filter;
+		FString JsonPath;
+		FParse::Value(Params, TEXT("MinTime="), MinSeconds);
+		FParse::Value(Params, TEXT("Trials="), NumTrials);
+		FParse::Value(Params, TEXT("Filter="), Filter);
+		FParse::Value(Params, TEXT("Json="), JsonPath);
+
+		const EVectorTier PreviousTier = GetVectorTier();
+		FString TierName;
+		if (FParse::Value(Params, TEXT("Tier="), TierName))
+		{
+			const EVectorTier* RequestedTier = Algo::FindByPredicate(AllVectorTiers, [&TierName](EVectorTier InTier) { return TierName.Equals(LexToString(InTier), ESearchCase::IgnoreCase); });
+			if (nullptr == RequestedTier)
+			{
+				UE_LOG(LogMetasoundExtensionsBenchmark, Error, TEXT("Unknown vector tier '%s'; expected Baseline, Avx2 or Avx512"), *TierName);
+				return 1;
+			}
+
+			if (SetVectorTier(*RequestedTier) != *RequestedTier)
+			{
+				UE_LOG(LogMetasoundExtensionsBenchmark, Error, TEXT("Vector tier %s is not supported on this machine"), LexToString(*RequestedTier));
+				SetVectorTier(PreviousTier);
+				return 1;
+			}
+		}
+
+		const bool bWasUsingIspc = IsUsingIspcKernels();
+		bool bUseIspc = bWasUsingIspc;
+		FParse::Bool(Params, TEXT("Ispc="), bUseIspc);
+		if (SetUseIspcKernels(bUseIspc) != bUseIspc)
+		{
+			UE_LOG(LogMetasoundExtensionsBenchmark, Error, TEXT("This build does not contain the ISPC kernels"));
+			SetVectorTier(PreviousTier);
+			return 1;
+		}
+
+		// The node module owns the table in the engine; nothing else builds it here.
+		InitializeSineTable(DefaultSineTableSize);
+
+		UE_LOG(LogMetasoundExtensionsBenchmark, Display, TEXT("CPU: %s, sine table: %d entries, vector tier: %s (supported: %s), ISPC: %s"),
+			*FPlatformMisc::GetCPUBrand().TrimStartAndEnd(), GetSineTableSize(), LexToString(GetVectorTier()), LexToString(GetSupportedVectorTier()), IsUsingIspcKernels() ? TEXT("on") : TEXT("off"));
+		UE_LOG(LogMetasoundExtensionsBenchmark, Display, TEXT("%-18s %-12s %-12s %8s %12s %12s"), TEXT("Kernel"), TEXT("Precision"), TEXT("Shape"), TEXT("Values"), TEXT("ns/value"), TEXT("values/cycle"));
+
+		FBenchmarkRunner Runner(MinSeconds, NumTrials, Filter);
+		FBenchmarkData Data;
+
+		RunTrigBenchmarks(Runner, Data);
+		RunDecimationBenchmarks(Runner, Data);
+		RunConversionBenchmarks(Runner, Data);
+		RunOscillatorBenchmarks(Runner, Data);
+
+		int32 ExitCode = 0;
+		if (!JsonPath.IsEmpty())
+		{
+			if (WriteJson(JsonPath, Runner.GetResults()))
+			{
+				UE_LOG(LogMetasoundExtensionsBenchmark, Display, TEXT("Wrote %d results to %s"), Runner.GetResults().Num(), *JsonPath);
+			}
+			else
+			{
+				UE_LOG(LogMetasoundExtensionsBenchmark, Error, TEXT("Failed to write results to %s"), *JsonPath);
+				ExitCode = 1;
+			}
+		}
+
+		ReleaseSineTable();
+
+		SetVectorTier(PreviousTier);
+		SetUseIspcKernels(bWasUsingIspc);
+
+		return ExitCode;
+	}
+}
+
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+{
+	FTaskTagScope Scope(ETaskTag::EGameThread);
+	ON_SCOPE_EXIT
+	{
+		RequestEngineExit(TEXT("Exiting"));
+		FEngineLoop::AppPreExit();
+		FModuleManager::Get().UnloadModulesAtShutdown();
+		FEngineLoop::AppExit();
+	};
+
+	if (const int32 PreInitResult = GEngineLoop.PreInit(ArgC, ArgV))
+	{
+		return PreInitResult;
+	}
+
+	// Start from the widest tier, as the node module does at startup.
+	Metasound::ExtensionsMath::SetVectorTier(Metasound::ExtensionsMath::GetSupportedVectorTier());
+
+	return MetasoundExtensionsBenchmarkPrivate::RunBenchmarks(FCommandLine::Get());
+}